@@ -3,21 +3,158 @@
 #include "view/cli/CliView.hpp"
 #include "controller/CommandController.hpp"
 #include "io/InputStream.hpp"
+#include "io/OutputStream.hpp"
+#include <chrono>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
-int main(int argc, char* argv[]) { 
+namespace {
+
+constexpr const char* USAGE =
+    "Usage: SlideEditor [--script <file> | --stdin-batch | --plan <file>] [--fail-fast] [--quiet]\n"
+    "       SlideEditor --compile <script> <plan>\n"
+    "       SlideEditor --check <script>\n"
+    "  (no options)        interactive mode\n"
+    "  --script <file>     run the commands in <file> without banner or prompts\n"
+    "  --stdin-batch       run the commands on standard input without banner or prompts\n"
+    "  --plan <file>       run a plan written by --compile without banner or prompts\n"
+    "  --compile <s> <p>   check script <s> and write its compiled plan to <p>\n"
+    "  --check <file>      report every line of <file> that does not parse; runs nothing\n"
+    "  --fail-fast         in batch modes, stop and exit non-zero on the first failing command\n"
+    "  --quiet             in batch modes, write errors only; successful commands print nothing\n";
+
+struct Options {
+    bool batch = false;
+    bool failFast = false;
+    bool quiet = false;
+    std::string scriptPath;  // Empty in --stdin-batch mode
+    std::string planPath;    // --plan input or --compile output
+    bool compile = false;
+    bool check = false;
+};
+
+bool parseArguments(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--script") == 0 && i + 1 < argc && !options.batch) {
+            options.batch = true;
+            options.scriptPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--stdin-batch") == 0 && !options.batch) {
+            options.batch = true;
+        }
+        else if (std::strcmp(argv[i], "--plan") == 0 && i + 1 < argc && !options.batch) {
+            options.batch = true;
+            options.planPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--compile") == 0 && i + 2 < argc && !options.batch) {
+            options.batch = true;
+            options.compile = true;
+            options.scriptPath = argv[++i];
+            options.planPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--check") == 0 && i + 1 < argc && !options.batch) {
+            options.batch = true;
+            options.check = true;
+            options.scriptPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--fail-fast") == 0) {
+            options.failFast = true;
+        }
+        else if (std::strcmp(argv[i], "--quiet") == 0) {
+            options.quiet = true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    const bool runsCommands = options.batch && !options.compile && !options.check;
+    return (!options.failFast && !options.quiet) || runsCommands;
+}
+
+bool readFile(const std::string& path, std::string& text) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    // Regular files are read in one go; pipes (e.g. <(generator)) cannot seek
+    const std::streampos size = file.seekg(0, std::ios::end).tellg();
+    if (size != std::streampos(-1) && file.seekg(0)) {
+        text.resize(static_cast<size_t>(size));
+        return static_cast<bool>(file.read(text.data(), static_cast<std::streamsize>(text.size())));
+    }
+
+    file.clear();
+    text.clear();
+    constexpr size_t CHUNK = 1 << 20;
+    while (file) {
+        const size_t offset = text.size();
+        text.resize(offset + CHUNK);
+        file.read(text.data() + offset, static_cast<std::streamsize>(CHUNK));
+        text.resize(offset + static_cast<size_t>(file.gcount()));
+    }
+
+    return file.eof() && !file.bad();
+}
+
+void printStats(const slideEditor::controller::BatchStats& stats) {
+    // Totals go to stderr so stdout holds only command output
+    const double rate = stats.seconds > 0 ? stats.commands / stats.seconds : 0;
+    std::cerr << "Processed " << stats.commands << " commands, "
+              << stats.failures << " failed, in " << stats.seconds * 1000.0 << " ms ("
+              << static_cast<long long>(rate) << " commands/s)" << std::endl;
+    if (stats.firstFailedLine != 0) {
+        std::cerr << "First failure at line " << stats.firstFailedLine << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
     using namespace slideEditor;
 
-    std::ignore = argc;
-    std::ignore = argv;
-    
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << USAGE;
+        return 2;
+    }
+
+    std::ifstream script;
+    if (!options.scriptPath.empty() && !options.compile && !options.check) {
+        script.open(options.scriptPath, std::ios::binary);
+        if (!script) {
+            std::cerr << "Cannot open script: " << options.scriptPath << std::endl;
+            return 2;
+        }
+    }
+
+    if (options.batch) {
+        // Nothing is interleaved with C stdio, and reads need not flush pending output
+        std::ios::sync_with_stdio(false);
+        std::cin.tie(nullptr);
+    }
+
     // Create core components with shared_ptr
     auto repository = std::make_shared<model::SlideRepository>();
     auto serializer = std::make_shared<serialization::JsonSerializer>();
-    auto view = std::make_shared<view::CliView>(std::cout);
-    auto inputStream = std::make_shared<io::InputStream>(std::cin);
-    
+    // Command output and the view share one buffer, written out at the prompt,
+    // after errors and when a run ends instead of once per line
+    auto output = std::make_shared<io::OutputStream>(std::cout, io::OutputStream::Buffering::FULL);
+    if (options.quiet) {
+        output->setVerbosity(core::Verbosity::QUIET);
+    }
+    auto view = std::make_shared<view::CliView>(output);
+    // Batch input is read in full blocks; a terminal gets what it has ready
+    auto inputStream = std::make_shared<io::InputStream>(
+        options.scriptPath.empty() ? static_cast<std::istream&>(std::cin) : script,
+        options.batch ? io::InputStream::FillMode::BLOCK : io::InputStream::FillMode::AVAILABLE);
+
     // Create controller (handles all logic internally)
     controller::CommandController controller(
         repository,
@@ -25,7 +162,74 @@ int main(int argc, char* argv[]) {
         view,
         inputStream
     );
-    
+    controller.setOutput(output);
+
+    if (options.compile || options.check) {
+        std::string text;
+        if (!readFile(options.scriptPath, text)) {
+            std::cerr << "Cannot open script: " << options.scriptPath << std::endl;
+            return 2;
+        }
+
+        if (options.check) {
+            const auto start = std::chrono::steady_clock::now();
+            controller::CheckResult result = controller.checkScript(text);
+            const double seconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            for (const auto& error : result.errors) {
+                std::cerr << options.scriptPath << ":" << error.line << ": "
+                          << error.message << "\n";
+            }
+            std::cerr << "Checked " << result.lines << " lines (" << result.commands
+                      << " commands), " << result.errors.size() << " errors, in "
+                      << seconds * 1000.0 << " ms" << std::endl;
+            return result.errors.empty() ? 0 : 1;
+        }
+
+        std::vector<controller::PlanError> errors;
+        controller::CommandPlan plan = controller.compilePlan(text, errors);
+        for (const auto& error : errors) {
+            std::cerr << options.scriptPath << ":" << error.line << ": "
+                      << error.message << std::endl;
+        }
+        if (!errors.empty()) {
+            return 1;
+        }
+
+        std::ofstream out(options.planPath, std::ios::binary);
+        if (!out || !plan.save(out)) {
+            std::cerr << "Cannot write plan: " << options.planPath << std::endl;
+            return 2;
+        }
+
+        std::cerr << "Compiled " << plan.size() << " commands" << std::endl;
+        return 0;
+    }
+
+    if (!options.planPath.empty()) {
+        std::ifstream in(options.planPath, std::ios::binary);
+        controller::CommandPlan plan;
+        if (!in || !plan.load(in)) {
+            std::cerr << "Cannot load plan: " << options.planPath << std::endl;
+            return 2;
+        }
+
+        controller::BatchStats stats = controller.runPlan(plan, options.failFast);
+        std::cout.flush();
+        printStats(stats);
+        return stats.stopped ? 1 : 0;
+    }
+
+    if (options.batch) {
+        // With a spare core, lines are read and parsed while earlier ones execute
+        controller::BatchStats stats = std::thread::hardware_concurrency() > 1
+            ? controller.runPipelined(options.failFast)
+            : controller.runBatch(options.failFast);
+        std::cout.flush();
+        printStats(stats);
+        return stats.stopped ? 1 : 0;
+    }
+
     // Run interactive mode
     try {
         controller.run();
@@ -33,6 +237,6 @@ int main(int argc, char* argv[]) {
         std::cerr << "Fatal error: " << e.what() << std::endl;
         return 1;
     }
-    
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,340 @@
+#include <benchmark/benchmark.h>
+#include "controller/CommandController.hpp"
+#include "controller/CommandRegistry.hpp"
+#include "controller/ScriptChecker.hpp"
+#include "controller/commands/MetaCommandDefinitions.hpp"
+#include "controller/commands/UndoableCommands.hpp"
+#include "controller/parser/CommandParser.hpp"
+#include "model/SlideFactory.hpp"
+#include "model/SlideRepository.hpp"
+#include "serialization/JsonSerializer.hpp"
+#include "view/cli/CliView.hpp"
+#include "io/InputStream.hpp"
+#include "io/OutputStream.hpp"
+#include "io/SpanInputStream.hpp"
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace slideEditor;
+using namespace slideEditor::controller;
+
+namespace {
+
+const std::string LINE = "svgmode plain";
+const std::string ADDSHAPE_LINE = "addshape 1 circle 2.5 red blue";
+
+// Discards everything, so output cost does not drown the pipeline cost
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Sends std::cout to a NullBuffer for the lifetime of the object
+class MuteCout {
+public:
+    MuteCout() : saved_(std::cout.rdbuf(&buffer_)) {}
+    ~MuteCout() { std::cout.rdbuf(saved_); }
+
+private:
+    NullBuffer buffer_;
+    std::streambuf* saved_;
+};
+
+void registerCommands(CommandRegistry& registry) {
+    registry.registerCommand(createSvgModeMetaCommand());
+    registry.registerCommand(createCreateMetaCommand());
+    registry.registerCommand(createHelpMetaCommand());
+    registry.registerCommand(createAddShapeMetaCommand());
+}
+
+std::shared_ptr<model::SlideRepository> makeRepositoryWithSlide() {
+    auto repository = std::make_shared<model::SlideRepository>();
+    repository->addSlide(model::SlideFactory::createSlide(0, "Title", "Content", "Theme"));
+    return repository;
+}
+
+} // namespace
+
+// Per-line objects as the controller used to build them: stream over a copy, parser, lexer, output
+static void BM_ParseFreshPipeline(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    NullBuffer sink;
+    std::ostream out(&sink);
+
+    for (auto _ : state) {
+        auto stream = std::make_shared<io::InputStream>(LINE);
+        CommandParser parser(stream.get());
+        parser.setRegistry(&registry);
+        ParsedCommand parsed = parser.parseCommand();
+        auto output = std::make_shared<io::OutputStream>(out);
+        benchmark::DoNotOptimize(parsed.isValid);
+        benchmark::DoNotOptimize(output.get());
+    }
+}
+BENCHMARK(BM_ParseFreshPipeline);
+
+// Long-lived stream and parser reset over each line
+static void BM_ParseReusedPipeline(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    io::SpanInputStream input;
+    CommandParser parser(&input);
+    parser.setRegistry(&registry);
+
+    for (auto _ : state) {
+        input.reset(LINE);
+        parser.reset();
+        ParsedCommand parsed = parser.parseCommand();
+        benchmark::DoNotOptimize(parsed.isValid);
+    }
+}
+BENCHMARK(BM_ParseReusedPipeline);
+
+// Long-lived parser lexing each line in place with its SpanLexer
+static void BM_ParseSpan(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    CommandParser parser;
+    parser.setRegistry(&registry);
+
+    for (auto _ : state) {
+        parser.reset(LINE);
+        ParsedCommand parsed = parser.parseCommand();
+        benchmark::DoNotOptimize(parsed.isValid);
+    }
+}
+BENCHMARK(BM_ParseSpan);
+
+// The command alone: create from parsed arguments and execute
+static void BM_CommandOnly(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    CommandContext context;
+    context.setRenderOptions(std::make_shared<view::SvgOptions>());
+    const auto creator = registry.getMetaCommand("svgmode")->getCreator();
+    const std::vector<core::CommandArgument> arguments = {core::CommandArgument(std::string("plain"))};
+    NullBuffer sink;
+    std::ostream out(&sink);
+    io::OutputStream output(out);
+
+    for (auto _ : state) {
+        auto command = creator(arguments, &context);
+        benchmark::DoNotOptimize(command->execute(output));
+    }
+}
+BENCHMARK(BM_CommandOnly);
+
+// Whole controller path per line: parse, look up, create, execute
+static void BM_ProcessCommand(benchmark::State& state) {
+    MuteCout mute;
+    NullBuffer sink;
+    std::ostream viewOutput(&sink);
+    CommandController controller(std::make_shared<model::SlideRepository>(),
+                                 std::make_shared<serialization::JsonSerializer>(),
+                                 std::make_shared<view::CliView>(viewOutput),
+                                 nullptr);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(controller.processCommand(LINE));
+    }
+}
+BENCHMARK(BM_ProcessCommand);
+
+// addshape from text to executed command, with arguments turned back into strings,
+// re-validated and re-parsed by the creator as before typed arguments. Each
+// iteration undoes its shape so the slide does not grow.
+static void BM_AddShapeStringRoundTrip(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    auto repository = makeRepositoryWithSlide();
+    const auto* meta = registry.getMetaCommand("addshape");
+    CommandParser parser;
+    parser.setRegistry(&registry);
+    NullBuffer sink;
+    std::ostream out(&sink);
+    io::OutputStream output(out);
+
+    for (auto _ : state) {
+        parser.reset(ADDSHAPE_LINE);
+        ParsedCommand parsed = parser.parseCommand();
+        const auto args = parsed.getArgumentStrings();
+        if (!meta->validateArguments(args)) {
+            state.SkipWithError("invalid arguments");
+            break;
+        }
+        UndoableAddShapeCommand command(repository, std::stoi(args[0]), args[1],
+                                        std::stod(args[2]), args[3], args[4]);
+        benchmark::DoNotOptimize(command.execute(output));
+        command.undo();
+    }
+}
+BENCHMARK(BM_AddShapeStringRoundTrip);
+
+// The same path with the parsed values handed to the creator as they are
+static void BM_AddShapeTyped(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    CommandContext context;
+    context.setRepository(makeRepositoryWithSlide());
+    const auto creator = registry.getMetaCommand("addshape")->getCreator();
+    CommandParser parser;
+    parser.setRegistry(&registry);
+    NullBuffer sink;
+    std::ostream out(&sink);
+    io::OutputStream output(out);
+
+    for (auto _ : state) {
+        parser.reset(ADDSHAPE_LINE);
+        ParsedCommand parsed = parser.parseCommand();
+        auto command = creator(parsed.arguments, &context);
+        benchmark::DoNotOptimize(command->execute(output));
+        static_cast<core::IUndoableCommand*>(command.get())->undo();
+    }
+}
+BENCHMARK(BM_AddShapeTyped);
+
+// The same again through the typed invoker: no std::function, void* or dynamic_cast,
+// and history takes the command straight from the invoker
+static void BM_AddShapeInvoker(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    CommandContext context;
+    context.setRepository(makeRepositoryWithSlide());
+    CommandHistory history(1);  // Keeps one entry, so memory stays flat
+    const auto* invoker = registry.getInvoker("addshape");
+    CommandParser parser;
+    parser.setRegistry(&registry);
+    NullBuffer sink;
+    std::ostream out(&sink);
+    io::OutputStream output(out);
+
+    for (auto _ : state) {
+        parser.reset(ADDSHAPE_LINE);
+        ParsedCommand parsed = parser.parseCommand();
+        benchmark::DoNotOptimize(invoker->invoke(parsed.arguments, context, output, history));
+        history.undoLastAction();
+    }
+}
+BENCHMARK(BM_AddShapeInvoker);
+
+namespace {
+
+std::string makeScript(size_t lines) {
+    std::string script;
+    for (size_t i = 0; i < lines; ++i) {
+        script += (i % 2 == 0) ? "svgmode plain\n" : "svgmode styled\n";
+    }
+
+    return script;
+}
+
+} // namespace
+
+// A script read, lexed and parsed line by line
+static void BM_RunScript(benchmark::State& state) {
+    MuteCout mute;
+    NullBuffer sink;
+    std::ostream viewOutput(&sink);
+    const std::string script = makeScript(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        CommandController controller(std::make_shared<model::SlideRepository>(),
+                                     std::make_shared<serialization::JsonSerializer>(),
+                                     std::make_shared<view::CliView>(viewOutput),
+                                     std::make_shared<io::InputStream>(script));
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(controller.runBatch());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RunScript)->Arg(10000);
+
+// The same script compiled once and run as a plan
+static void BM_RunPlan(benchmark::State& state) {
+    MuteCout mute;
+    NullBuffer sink;
+    std::ostream viewOutput(&sink);
+    CommandController controller(std::make_shared<model::SlideRepository>(),
+                                 std::make_shared<serialization::JsonSerializer>(),
+                                 std::make_shared<view::CliView>(viewOutput),
+                                 nullptr);
+    std::vector<PlanError> errors;
+    const CommandPlan plan = controller.compilePlan(makeScript(static_cast<size_t>(state.range(0))),
+                                                    errors);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(controller.runPlan(plan));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RunPlan)->Arg(10000);
+
+// Actions and undos as a plan, with results written (1) or quiet (0): quiet
+// runs skip rendering the messages of commands that succeed
+static void BM_RunPlanOutput(benchmark::State& state) {
+    NullBuffer sink;
+    std::ostream stream(&sink);
+    auto output = std::make_shared<io::OutputStream>(stream);
+    output->setVerbosity(state.range(0) ? core::Verbosity::NORMAL : core::Verbosity::QUIET);
+    CommandController controller(std::make_shared<model::SlideRepository>(),
+                                 std::make_shared<serialization::JsonSerializer>(),
+                                 std::make_shared<view::CliView>(stream),
+                                 nullptr);
+    controller.setOutput(output);
+    
+    std::string script = "create Title Content Theme\n";
+    for (size_t i = 0; i < 10000; ++i) {
+        script += (i % 2 == 0) ? ADDSHAPE_LINE + "\n" : "undo\n";
+    }
+    std::vector<PlanError> errors;
+    const CommandPlan plan = controller.compilePlan(script, errors);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(controller.runPlan(plan));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(plan.size()));
+}
+BENCHMARK(BM_RunPlanOutput)->Arg(1)->Arg(0);
+
+// BM_RunScript with reading and parsing on a second thread
+static void BM_RunScriptPipelined(benchmark::State& state) {
+    MuteCout mute;
+    NullBuffer sink;
+    std::ostream viewOutput(&sink);
+    const std::string script = makeScript(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        CommandController controller(std::make_shared<model::SlideRepository>(),
+                                     std::make_shared<serialization::JsonSerializer>(),
+                                     std::make_shared<view::CliView>(viewOutput),
+                                     std::make_shared<io::InputStream>(script));
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(controller.runPipelined());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RunScriptPipelined)->Arg(10000)->UseRealTime();
+
+// Parse-only check of a script on a pool of state.range(1) workers
+static void BM_CheckScript(benchmark::State& state) {
+    CommandRegistry registry;
+    registerCommands(registry);
+    view::WorkStealingPool pool(static_cast<size_t>(state.range(1)));
+    ScriptChecker checker(registry);
+    std::string script;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        script += (i % 2 == 0) ? ADDSHAPE_LINE : "create Title Content Theme";
+        script += '\n';
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(checker.check(script, &pool));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(script.size()));
+}
+BENCHMARK(BM_CheckScript)->Args({200000, 1})->Args({200000, 4})->UseRealTime();
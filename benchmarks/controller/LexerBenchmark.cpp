@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include "controller/parser/Lexer.hpp"
+#include "controller/parser/SpanLexer.hpp"
+#include "io/SpanInputStream.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace slideEditor;
+using namespace slideEditor::controller;
+
+namespace {
+
+// A generated script: mostly addshape lines with a create every 50 lines
+std::string makeScript(size_t lines) {
+    std::string script;
+    for (size_t i = 0; i < lines; ++i) {
+        if (i % 50 == 0) {
+            script += "create Title" + std::to_string(i) + " Content DarkTheme\n";
+        } 
+        else {
+            script += "addshape " + std::to_string(i / 50 + 1) + " circle 2.5 red blue\n";
+        }
+    }
+
+    return script;
+}
+
+const std::string SCRIPT = makeScript(10000);
+
+} // namespace
+
+// Baseline: copying the script once
+static void BM_Memcpy(benchmark::State& state) {
+    std::vector<char> copy(SCRIPT.size());
+
+    for (auto _ : state) {
+        std::memcpy(copy.data(), SCRIPT.data(), SCRIPT.size());
+        benchmark::DoNotOptimize(copy.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * SCRIPT.size());
+}
+BENCHMARK(BM_Memcpy);
+
+// Character-at-a-time Lexer through IInputStream, building owning Tokens
+static void BM_StreamLexer(benchmark::State& state) {
+    io::SpanInputStream input;
+    Lexer lexer(&input);
+
+    for (auto _ : state) {
+        input.reset(SCRIPT);
+        lexer.reset();
+        size_t count = 0;
+        while (lexer.nextToken().type != TokenType::END_OF_FILE) {
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * SCRIPT.size());
+}
+BENCHMARK(BM_StreamLexer);
+
+// SpanLexer over the same text, producing slices
+static void BM_SpanLexer(benchmark::State& state) {
+    SpanLexer lexer;
+
+    for (auto _ : state) {
+        lexer.reset(SCRIPT);
+        size_t count = 0;
+        while (lexer.nextToken().type != TokenType::END_OF_FILE) {
+            ++count;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetBytesProcessed(state.iterations() * SCRIPT.size());
+}
+BENCHMARK(BM_SpanLexer);
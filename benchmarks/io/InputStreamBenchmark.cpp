@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+#include "io/InputStream.hpp"
+#include <sstream>
+#include <string>
+
+using namespace slideEditor;
+
+namespace {
+
+std::string makeScript(size_t lines) {
+    std::string script;
+    for (size_t i = 0; i < lines; ++i) {
+        script += "addshape " + std::to_string(i % 100 + 1) + " circle 2.5 red blue\n";
+    }
+
+    return script;
+}
+
+const std::string SCRIPT = makeScript(100000);
+
+// Reads through std::istream::get one character at a time, as InputStream used to
+class CharwiseStream : public core::IInputStream {
+public:
+    explicit CharwiseStream(std::istream& stream) : stream_(stream) {}
+
+    std::optional<char> get() override {
+        char c;
+        if (stream_.get(c)) {
+            return c;
+        }
+        return std::nullopt;
+    }
+    std::optional<char> peek() override {
+        const int c = stream_.peek();
+        if (c == EOF) {
+            return std::nullopt;
+        }
+        return static_cast<char>(c);
+    }
+    bool eof() const override { return stream_.eof(); }
+    bool good() const override { return stream_.good(); }
+    void unget() override { stream_.unget(); }
+
+private:
+    std::istream& stream_;
+};
+
+} // namespace
+
+// Default IInputStream::readLine over per-character istream calls
+static void BM_ReadLinesCharwise(benchmark::State& state) {
+    for (auto _ : state) {
+        std::istringstream source(SCRIPT);
+        CharwiseStream stream(source);
+        std::string line;
+        size_t lines = 0;
+        while (stream.readLine(line)) {
+            ++lines;
+        }
+        benchmark::DoNotOptimize(lines);
+    }
+    state.SetBytesProcessed(state.iterations() * SCRIPT.size());
+}
+BENCHMARK(BM_ReadLinesCharwise);
+
+// InputStream in BLOCK mode: 64 KiB refills and memchr line scans
+static void BM_ReadLinesBuffered(benchmark::State& state) {
+    for (auto _ : state) {
+        std::istringstream source(SCRIPT);
+        io::InputStream stream(source, io::InputStream::FillMode::BLOCK);
+        std::string line;
+        size_t lines = 0;
+        while (stream.readLine(line)) {
+            ++lines;
+        }
+        benchmark::DoNotOptimize(lines);
+    }
+    state.SetBytesProcessed(state.iterations() * SCRIPT.size());
+}
+BENCHMARK(BM_ReadLinesBuffered);
@@ -0,0 +1,179 @@
+#include <benchmark/benchmark.h>
+#include "model/shapes/Shape.hpp"
+#include "model/SvgFormatter.hpp"
+#include <sstream>
+#include <vector>
+
+using namespace slideEditor::model;
+using namespace slideEditor::core;
+
+namespace {
+
+// The pre-SvgFormatter Shape::toSVG path: one ostringstream per element,
+// default stream double formatting and two Color::toHex temporaries.
+std::string legacyToSVG(const Shape& shape, double x, double y) {
+    std::ostringstream svg;
+    std::string fill = Color::White().toHex();
+    std::string stroke = Color::Black().toHex();
+    double strokeWidth = 2.0;
+    double opacity = 1.0;
+    switch (shape.getType()) {
+        case ShapeType::CIRCLE:
+            svg << "<circle cx=\"" << x << "\" cy=\"" << y << "\" r=\"" << shape.getCircleRadius() << "\" "
+                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
+                << "stroke-width=\"" << strokeWidth << "\" "
+                << "fill-opacity=\"" << opacity << "\" />";
+            break;
+        case ShapeType::RECTANGLE: {
+            double w = shape.getRectangleWidth();
+            double h = shape.getRectangleHeight();
+            svg << "<rect x=\"" << (x - w/2) << "\" y=\"" << (y - h/2) << "\" "
+                << "width=\"" << w << "\" height=\"" << h << "\" "
+                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
+                << "stroke-width=\"" << strokeWidth << "\" "
+                << "fill-opacity=\"" << opacity << "\" />";
+            break;
+        }
+        case ShapeType::TRIANGLE: {
+            double side = shape.getTriangleSide();
+            double height = side * 0.8660254037844386;
+            svg << "<polygon points=\""
+                << x << "," << (y - height * 2.0 / 3.0) << " "
+                << (x - side / 2.0) << "," << (y + height / 3.0) << " "
+                << (x + side / 2.0) << "," << (y + height / 3.0) << "\" "
+                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
+                << "stroke-width=\"" << strokeWidth << "\" "
+                << "fill-opacity=\"" << opacity << "\" />";
+            break;
+        }
+        case ShapeType::ELLIPSE:
+            svg << "<ellipse cx=\"" << x << "\" cy=\"" << y << "\" "
+                << "rx=\"" << shape.getEllipseRadiusX() << "\" ry=\"" << shape.getEllipseRadiusY() << "\" "
+                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
+                << "stroke-width=\"" << strokeWidth << "\" "
+                << "fill-opacity=\"" << opacity << "\" />";
+            break;
+    }
+
+    return svg.str();
+}
+
+// Per-character escaping, the straightforward alternative to SvgFormatter::appendEscaped
+void naiveEscape(std::string& out, const std::string& text) {
+    for (char c : text) {
+        switch (c) {
+            case '&': out += "&amp;"; break;
+            case '<': out += "&lt;"; break;
+            case '>': out += "&gt;"; break;
+            case '"': out += "&quot;"; break;
+            case '\'': out += "&apos;"; break;
+            default: out += c; break;
+        }
+    }
+}
+
+// Slide-like text of about 4 KiB; dirty text has a special character every ~40 bytes
+std::string makeText(bool dirty) {
+    const std::string clean = "Revenue grew in every region this quarter, ";
+    const std::string special = "R&D <beta> \"launch\" isn't final, ";
+    std::string text;
+    for (int i = 0; text.size() < 4096; ++i) {
+        text += (dirty && i % 2) ? special : clean;
+    }
+
+    return text;
+}
+
+std::vector<Shape> makeShapes() {
+    return {
+        Shape(ShapeType::CIRCLE, 1.37),
+        Shape(ShapeType::RECTANGLE, 0.85),
+        Shape(ShapeType::TRIANGLE, 1.2),
+        Shape(ShapeType::ELLIPSE, 2.05)
+    };
+}
+
+} // namespace
+
+static void BM_LegacyToSVG(benchmark::State& state) {
+    auto shapes = makeShapes();
+    double y = 150.25;
+    for (auto _ : state) {
+        for (const auto& shape : shapes) {
+            benchmark::DoNotOptimize(legacyToSVG(shape, 100.5, y));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * shapes.size());
+}
+BENCHMARK(BM_LegacyToSVG);
+
+static void BM_ToSVG(benchmark::State& state) {
+    auto shapes = makeShapes();
+    double y = 150.25;
+    for (auto _ : state) {
+        for (const auto& shape : shapes) {
+            benchmark::DoNotOptimize(shape.toSVG(100.5, y));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * shapes.size());
+}
+BENCHMARK(BM_ToSVG);
+
+static void BM_AppendSVG_ReusedBuffer(benchmark::State& state) {
+    auto shapes = makeShapes();
+    std::string buffer;
+    double y = 150.25;
+    for (auto _ : state) {
+        buffer.clear();
+        for (const auto& shape : shapes) {
+            shape.appendSVG(buffer, 100.5, y);
+        }
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * shapes.size());
+}
+BENCHMARK(BM_AppendSVG_ReusedBuffer);
+
+static void BM_AppendNumber(benchmark::State& state) {
+    std::string buffer;
+    double value = 123.456;
+    for (auto _ : state) {
+        buffer.clear();
+        SvgFormatter::appendNumber(buffer, value);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(BM_AppendNumber);
+
+// Arg: 0 clean text, 1 dirty text
+static void BM_NaiveEscape(benchmark::State& state) {
+    const std::string text = makeText(state.range(0) != 0);
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        naiveEscape(buffer, text);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(text.size()) * state.iterations());
+    state.SetLabel(state.range(0) ? "dirty" : "clean");
+}
+BENCHMARK(BM_NaiveEscape)->Arg(0)->Arg(1);
+
+static void BM_AppendEscaped(benchmark::State& state) {
+    const std::string text = makeText(state.range(0) != 0);
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        SvgFormatter::appendEscaped(buffer, text);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(text.size()) * state.iterations());
+    state.SetLabel(state.range(0) ? "dirty" : "clean");
+}
+BENCHMARK(BM_AppendEscaped)->Arg(0)->Arg(1);
@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+#include "view/raster/RasterRenderer.hpp"
+#include "view/raster/TileRenderer.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+#include <cstdio>
+
+using namespace slideEditor;
+using namespace slideEditor::view;
+
+namespace {
+
+// Reports throughput as megapixels of canvas per second
+void setMegapixelRate(benchmark::State& state, double pixelsPerIteration) {
+    state.counters["MP/s"] = benchmark::Counter(
+        pixelsPerIteration * static_cast<double>(state.iterations()) / 1e6,
+        benchmark::Counter::kIsRate);
+}
+
+void fillRepository(model::SlideRepository& repository, int slideCount) {
+    static const char* types[] = {"circle", "rectangle", "triangle", "ellipse"};
+    for (int i = 0; i < slideCount; ++i) {
+        auto slide = model::SlideFactory::createSlide(0, "Title", "Content", "default");
+        for (int s = 0; s < 10; ++s) {
+            slide->addShape(model::SlideFactory::createShape(types[s % 4], 0.6 + 0.1 * (s % 5),
+                                                             "black", "orange"));
+        }
+
+        repository.addSlide(std::move(slide));
+    }
+}
+
+} // namespace
+
+static void BM_FillSpan(benchmark::State& state) {
+    RasterCanvas canvas(800, 650);
+    const std::uint32_t color = RasterCanvas::packColor(12, 34, 56);
+    for (auto _ : state) {
+        for (int y = 0; y < canvas.getHeight(); ++y) {
+            canvas.fillSpan(y, 0, canvas.getWidth(), color);
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    setMegapixelRate(state, 800.0 * 650.0);
+}
+BENCHMARK(BM_FillSpan);
+
+static void BM_BlendSpan(benchmark::State& state) {
+    RasterCanvas canvas(800, 650);
+    canvas.clear(RasterRenderer::BACKGROUND);
+    const std::uint32_t color = RasterCanvas::packColor(12, 34, 56);
+    for (auto _ : state) {
+        for (int y = 0; y < canvas.getHeight(); ++y) {
+            canvas.blendSpan(y, 0, canvas.getWidth(), color, 100);
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    setMegapixelRate(state, 800.0 * 650.0);
+}
+BENCHMARK(BM_BlendSpan);
+
+static void BM_RasterizeShapes(benchmark::State& state) {
+    const auto type = static_cast<core::ShapeType>(state.range(0));
+    RasterCanvas canvas(200, 200);
+    RasterShape shape{type, 100.0, 100.0, 80.0, 60.0,
+                      RasterCanvas::packColor(255, 165, 0), RasterCanvas::packColor(0, 0, 0), 2.0};
+    if (type == core::ShapeType::TRIANGLE) {
+        shape.ry = 138.0;
+        shape.cy = 110.0;
+    }
+
+    for (auto _ : state) {
+        Rasterizer::draw(canvas, shape);
+        benchmark::ClobberMemory();
+    }
+
+    const RasterBounds box = Rasterizer::bounds(shape);
+    setMegapixelRate(state, (box.right - box.left) * (box.bottom - box.top));
+    state.SetLabel(core::shapeTypeToString(type));
+}
+BENCHMARK(BM_RasterizeShapes)->DenseRange(0, 3);
+
+static void BM_RenderDeck(benchmark::State& state) {
+    model::SlideRepository repository;
+    fillRepository(repository, static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        RasterCanvas canvas = RasterRenderer::render(&repository, 0, repository.getSlideCount());
+        benchmark::DoNotOptimize(canvas.getPixels().data());
+    }
+
+    setMegapixelRate(state, 800.0 * RasterRenderer::canvasHeight(repository.getSlideCount()));
+}
+BENCHMARK(BM_RenderDeck)->Arg(1)->Arg(16)->Unit(benchmark::kMillisecond);
+
+static void BM_RenderDeckTiled(benchmark::State& state) {
+    model::SlideRepository repository;
+    fillRepository(repository, static_cast<int>(state.range(0)));
+    WorkStealingPool pool(static_cast<size_t>(state.range(1)));
+    auto scene = RasterRenderer::buildScene(&repository, 0, repository.getSlideCount());
+    const int height = RasterRenderer::canvasHeight(repository.getSlideCount());
+    for (auto _ : state) {
+        RasterCanvas canvas = TileRenderer::render(scene, 800, height, RasterRenderer::BACKGROUND, pool);
+        benchmark::DoNotOptimize(canvas.getPixels().data());
+    }
+
+    setMegapixelRate(state, 800.0 * height);
+}
+BENCHMARK(BM_RenderDeckTiled)->ArgsProduct({{16}, {1, 2, 4, 8}})->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Whole-deck PNG export: tiled rendering streamed through the encoder
+static void BM_ExportDeckPNG(benchmark::State& state) {
+    model::SlideRepository repository;
+    fillRepository(repository, static_cast<int>(state.range(0)));
+    const char* filename = "bench_export.png";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(RasterRenderer::renderToFile(&repository, filename, ImageFormat::PNG,
+                                                              0, repository.getSlideCount()));
+    }
+
+    std::remove(filename);
+    setMegapixelRate(state, 800.0 * RasterRenderer::canvasHeight(repository.getSlideCount()));
+}
+BENCHMARK(BM_ExportDeckPNG)->Arg(100)->Arg(1000)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_EncodePNG(benchmark::State& state) {
+    model::SlideRepository repository;
+    fillRepository(repository, 4);
+    RasterCanvas canvas = RasterRenderer::render(&repository, 0, repository.getSlideCount());
+    const char* filename = "bench_encode.png";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ImageWriter::save(canvas, filename, ImageFormat::PNG));
+    }
+
+    std::remove(filename);
+    setMegapixelRate(state, static_cast<double>(canvas.getWidth()) * canvas.getHeight());
+}
+BENCHMARK(BM_EncodePNG)->Unit(benchmark::kMillisecond);
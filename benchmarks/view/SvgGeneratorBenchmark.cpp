@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include "view/SvgGenerator.hpp"
+#include "view/SvgRenderer.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+
+using namespace slideEditor;
+using namespace slideEditor::view;
+
+namespace {
+
+const char* const MODES[] = {"plain", "defs", "classes", "compact"};
+
+void fillRepository(model::SlideRepository& repository, int slideCount) {
+    static const char* types[] = {"circle", "rectangle", "triangle", "ellipse"};
+    static const char* fills[] = {"white", "orange", "blue"};
+    for (int i = 0; i < slideCount; ++i) {
+        auto slide = model::SlideFactory::createSlide(0, "Title", "Content", "default");
+        for (int s = 0; s < 10; ++s) {
+            slide->addShape(model::SlideFactory::createShape(types[s % 4], 0.6 + 0.1 * (s % 5),
+                                                             "black", fills[(i + s) % 3]));
+        }
+
+        repository.addSlide(std::move(slide));
+    }
+}
+
+} // namespace
+
+// Args: slide count, output mode index into MODES
+static void BM_GenerateSVG(benchmark::State& state) {
+    model::SlideRepository repository;
+    fillRepository(repository, static_cast<int>(state.range(0)));
+    SvgOptions options;
+    SvgGenerator::parseMode(MODES[state.range(1)], options);
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::string svg = SvgGenerator::generateSVG(&repository, nullptr, options);
+        bytes = svg.size();
+        benchmark::DoNotOptimize(svg.data());
+    }
+
+    state.counters["KiB"] = static_cast<double>(bytes) / 1024.0;
+    state.SetBytesProcessed(static_cast<int64_t>(bytes) * state.iterations());
+    state.SetLabel(MODES[state.range(1)]);
+}
+BENCHMARK(BM_GenerateSVG)->ArgsProduct({{100, 1000}, {0, 1, 2, 3}})->Unit(benchmark::kMillisecond);
+
+// Same work through a long-lived renderer whose buffers survive between draws
+static void BM_RendererReuse(benchmark::State& state) {
+    model::SlideRepository repository;
+    fillRepository(repository, static_cast<int>(state.range(0)));
+    SvgOptions options;
+    SvgGenerator::parseMode(MODES[state.range(1)], options);
+    SvgRenderer renderer;
+
+    for (auto _ : state) {
+        const std::string& svg = renderer.render(&repository, 0, repository.getSlideCount(),
+                                                 nullptr, options);
+        benchmark::DoNotOptimize(svg.data());
+    }
+
+    state.counters["HighWaterKiB"] = static_cast<double>(renderer.getOutputHighWater()) / 1024.0;
+    state.SetBytesProcessed(static_cast<int64_t>(renderer.getOutputHighWater()) * state.iterations());
+    state.SetLabel(MODES[state.range(1)]);
+}
+BENCHMARK(BM_RendererReuse)->ArgsProduct({{100, 1000}, {0, 1, 2, 3}})->Unit(benchmark::kMillisecond);
@@ -7,6 +7,11 @@
 #include "interfaces/IView.hpp"
 #include "controller/CommandHistory.hpp"
 #include "controller/CommandRegistry.hpp"
+#include "view/SvgFragmentCache.hpp"
+#include "view/SvgGenerator.hpp"
+#include "view/SplitExporter.hpp"
+#include "view/SvgRenderer.hpp"
+#include "view/PreviewServer.hpp"
 #include <memory>
 #include <string>
 
@@ -27,16 +32,20 @@ public:
     void setView(std::shared_ptr<core::IView> view);
     void setHistory(std::shared_ptr<CommandHistory> history);
     void setRegistry(CommandRegistry* registry);
-    
+    void setRenderCache(std::shared_ptr<view::SvgFragmentCache> cache);
+    void setRenderOptions(std::shared_ptr<view::SvgOptions> options);
+    void setSplitExporter(std::shared_ptr<view::SplitExporter> exporter);
+    void setRenderer(std::shared_ptr<view::SvgRenderer> renderer);
+    void setPreviewServer(std::shared_ptr<view::PreviewServer> server);
     
     bool hasRepository() const override;
-    std::shared_ptr<core::ISlideRepository> getRepository() const override;
+    const std::shared_ptr<core::ISlideRepository>& getRepository() const override;
     
     bool hasSerializer() const override;
-    std::shared_ptr<core::ISerializer> getSerializer() const override;
+    const std::shared_ptr<core::ISerializer>& getSerializer() const override;
     
     bool hasView() const override;
-    std::shared_ptr<core::IView> getView() const override;
+    const std::shared_ptr<core::IView>& getView() const override;
     
     bool hasHistory() const override;
     void* getHistory() const override;
@@ -47,8 +56,20 @@ public:
     bool isValid() const override;
     std::string getMissingDependencies() const override;
     
-    std::shared_ptr<CommandHistory> getHistoryTyped() const;
+    const std::shared_ptr<CommandHistory>& getHistoryTyped() const;
     CommandRegistry* getRegistryTyped() const;
+    
+    // Optional: not part of isValid()
+    bool hasRenderCache() const;
+    const std::shared_ptr<view::SvgFragmentCache>& getRenderCache() const;
+    bool hasRenderOptions() const;
+    const std::shared_ptr<view::SvgOptions>& getRenderOptions() const;
+    bool hasSplitExporter() const;
+    const std::shared_ptr<view::SplitExporter>& getSplitExporter() const;
+    bool hasRenderer() const;
+    const std::shared_ptr<view::SvgRenderer>& getRenderer() const;
+    bool hasPreviewServer() const;
+    const std::shared_ptr<view::PreviewServer>& getPreviewServer() const;
 
 private:
     std::shared_ptr<core::ISlideRepository> repository_;
@@ -56,6 +77,11 @@ private:
     std::shared_ptr<core::IView> view_;
     std::shared_ptr<CommandHistory> history_;
     CommandRegistry* registry_;  // Non-owning pointer
+    std::shared_ptr<view::SvgFragmentCache> renderCache_;
+    std::shared_ptr<view::SvgOptions> renderOptions_;
+    std::shared_ptr<view::SplitExporter> splitExporter_;
+    std::shared_ptr<view::SvgRenderer> renderer_;
+    std::shared_ptr<view::PreviewServer> previewServer_;
 };
 
 } // namespace slideEditor::controller
@@ -8,12 +8,29 @@
 #include "interfaces/IInputStream.hpp"
 #include "controller/commands/CommandFactory.hpp"
 #include "controller/CommandHistory.hpp"
+#include "controller/CommandInvoker.hpp"
+#include "controller/CommandPlan.hpp"
+#include "controller/ScriptChecker.hpp"
+#include "controller/parser/CommandParser.hpp"
+#include "io/OutputStream.hpp"
 #include "CommandContext.hpp"
 #include <memory>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace slideEditor::controller {
 
+// Totals of a non-interactive run
+struct BatchStats {
+    size_t commands = 0;      // Non-empty lines processed
+    size_t failures = 0;
+    size_t firstFailedLine = 0;  // Input line of the first failure, 0 if none
+    bool stopped = false;     // Ended early on a failure
+    double seconds = 0;
+};
+
 class CommandController : public core::IController {
 public:
     CommandController(std::shared_ptr<core::ISlideRepository> repo,
@@ -21,8 +38,25 @@ public:
                      std::shared_ptr<core::IView> view,
                      std::shared_ptr<core::IInputStream> input);
     
+    // Command output goes to output instead of std::cout. Pass the stream a
+    // buffered CliView writes to, so that both share one buffer and one order.
+    void setOutput(std::shared_ptr<core::IOutputStream> output);
+    
     void run() override;
     bool processCommand(const std::string& commandLine) override;
+    
+    // Processes the whole input without banner or prompts until EOF or 'exit';
+    // with stopOnError, the first failing line ends the run
+    BatchStats runBatch(bool stopOnError = false);
+    // runBatch with reading and parsing on a second thread, handing parsed lines
+    // to this one through a bounded queue. Same order, output and stats.
+    BatchStats runPipelined(bool stopOnError = false);
+    // Same as runBatch over a compiled script; lines are the script's lines
+    BatchStats runPlan(const CommandPlan& plan, bool stopOnError = false);
+    // Compiles against this controller's commands
+    CommandPlan compilePlan(std::string_view script, std::vector<PlanError>& errors) const;
+    // Parses every line in parallel without executing anything
+    CheckResult checkScript(std::string_view script) const;
 
 private:
     std::shared_ptr<core::ISlideRepository> repository_;
@@ -32,13 +66,39 @@ private:
     
     std::shared_ptr<CommandHistory> commandHistory_;
     std::unique_ptr<CommandRegistry> commandRegistry_;
+    std::shared_ptr<view::SvgFragmentCache> renderCache_;  // Survives across draws
+    std::shared_ptr<view::SvgOptions> renderOptions_;      // Set by 'svgmode'
+    std::shared_ptr<view::SplitExporter> splitExporter_;   // Remembers what 'drawsplit' wrote
+    std::shared_ptr<view::SvgRenderer> renderer_;          // Buffers reused by every draw
+    std::shared_ptr<view::PreviewServer> previewServer_;   // Started by 'preview'
     
     CommandContext context_;  // Context for command creation
     
+    // Per-line pipeline, reset for every command line instead of rebuilt
+    CommandParser parser_;            // Lexes each line in place with a SpanLexer
+    std::shared_ptr<core::IOutputStream> commandOutput_;  // std::cout unless setOutput
+    std::ostream discardedOutput_;    // No buffer: writes are dropped
+    io::OutputStream groupOutput_;    // Actions inside a transaction; only errors are shown
+    
     bool running_;
     
+    enum class LineStatus {
+        SUCCEEDED,
+        FAILED,
+        EXIT
+    };
+    
     void initializeCommands();
-    bool processCommandLine(const std::string& commandLine);
+    void flushOutput();  // When a run ends
+    bool rollbackOpenGroup();  // When a run ends; true if a transaction was open
+    LineStatus processCommandLine(std::string_view commandLine);
+    LineStatus dispatchCommand(const ParsedCommand& parsed, const core::IMetaCommand* metaCmd,
+                               const CommandInvoker* invoker);
+    // Uses the typed invoker when there is one, else the metaCmd's creator
+    LineStatus executeCommand(const core::IMetaCommand& metaCmd, const CommandInvoker* invoker,
+                              core::ArgumentSpan arguments, bool isExit);
+    bool invokeTyped(const CommandInvoker& invoker, core::ArgumentSpan arguments);
+    bool invokeCreator(const core::IMetaCommand& metaCmd, core::ArgumentSpan arguments);
 };
 
 } // namespace slideEditor::controller
@@ -11,6 +11,9 @@ namespace slideEditor::controller {
 /**
  * CommandHistory - Manages undo/redo stacks
  * Uses two stacks: one for undo, one for redo
+ *
+ * Between beginGroup() and commitGroup(), pushed actions are held back and
+ * committed as a single UndoableGroupCommand entry.
  */
 class CommandHistory {
 public:
@@ -29,11 +32,24 @@ public:
     std::string getLastActionToRedo() const;
     
     void clearHistory();
+    
+    // Transactions; groups do not nest
+    bool beginGroup();        // False if a group is already open
+    size_t commitGroup();     // Number of actions committed
+    size_t rollbackGroup();   // Undoes the group's actions; number undone
+    bool isGroupOpen() const;
+    size_t getGroupSize() const;
 
 private:
+    void pushEntry(std::unique_ptr<core::IUndoableCommand> action);
+    
+
     std::vector<std::unique_ptr<core::IUndoableCommand>> undoStack_;
     std::vector<std::unique_ptr<core::IUndoableCommand>> redoStack_; 
     size_t maxHistorySize_;
+    
+    std::vector<std::unique_ptr<core::IUndoableCommand>> group_;  // Open group's actions
+    bool groupOpen_;
 };
 
 } // namespace slideEditor::controller
@@ -0,0 +1,88 @@
+#ifndef COMMAND_INVOKER_HPP
+#define COMMAND_INVOKER_HPP
+
+#include "interfaces/IMetaCommand.hpp"
+#include "interfaces/IOutputStream.hpp"
+#include "interfaces/IUndoableCommand.hpp"
+#include "controller/CommandHistory.hpp"
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace slideEditor::controller {
+
+class CommandContext;
+
+// Compile-time facts about a command class; specialize to override
+template <typename Command>
+struct CommandTraits {
+    static constexpr bool isUndoable = std::is_base_of_v<core::IUndoableCommand, Command>;
+};
+
+/**
+ * CommandInvoker - Builds, runs and records commands of one type
+ *
+ * The typed counterpart of CommandCreator: no std::function, no void*
+ * context and no dynamic_cast to find out whether the result is undoable.
+ * Only undoable commands are heap-allocated, because history keeps them;
+ * the others live on the stack for the duration of the call.
+ */
+class CommandInvoker {
+public:
+    virtual ~CommandInvoker() = default;
+
+    virtual bool isAction() const = 0;
+
+    // Creates and executes the command; a successful action is pushed to history.
+    // On failure the command's result message goes to failureMessage, if given.
+    virtual bool invoke(core::ArgumentSpan args, CommandContext& context,
+                        core::IOutputStream& output, CommandHistory& history,
+                        std::string* failureMessage = nullptr) const = 0;
+};
+
+// Factory: Command(core::ArgumentSpan, CommandContext&), returning by value
+template <typename Command, typename Factory>
+class TypedInvoker final : public CommandInvoker {
+public:
+    explicit TypedInvoker(Factory factory) : factory_(std::move(factory)) {}
+
+    bool isAction() const override {
+        return CommandTraits<Command>::isUndoable;
+    }
+
+    bool invoke(core::ArgumentSpan args, CommandContext& context,
+                core::IOutputStream& output, CommandHistory& history,
+                std::string* failureMessage) const override {
+        if constexpr (CommandTraits<Command>::isUndoable) {
+            // Built in place from the factory's result; nothing is moved
+            std::unique_ptr<Command> command(new Command(factory_(args, context)));
+            if (!command->execute(output)) {
+                if (failureMessage) {
+                    *failureMessage = command->getResultMessage();
+                }
+                return false;
+            }
+
+            history.pushAction(std::move(command));
+            return true;
+        }
+        else {
+            Command command = factory_(args, context);
+            if (!command.execute(output)) {
+                if (failureMessage) {
+                    *failureMessage = command.getResultMessage();
+                }
+                return false;
+            }
+
+            return true;
+        }
+    }
+
+private:
+    Factory factory_;
+};
+
+} // namespace slideEditor::controller
+
+#endif // COMMAND_INVOKER_HPP
@@ -0,0 +1,64 @@
+#ifndef COMMAND_PLAN_HPP
+#define COMMAND_PLAN_HPP
+
+#include "interfaces/IMetaCommand.hpp"
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace slideEditor::controller {
+
+class CommandRegistry;
+
+// One compiled command: its keyword and a range of argument slots
+struct PlanOp {
+    uint8_t opcode;       // keywords:: index of the command
+    uint8_t argCount;
+    uint32_t firstArg;    // Index into CommandPlan's argument slots
+    uint32_t line;        // Script line, for error reports
+};
+
+struct PlanError {
+    size_t line;
+    std::string message;
+};
+
+/**
+ * CommandPlan - A script compiled to typed operations
+ *
+ * compile() lexes, parses and validates every line once. Running the plan
+ * (CommandController::runPlan) hands each operation's argument slots
+ * straight to the command's creator, without the Lexer, the CommandParser
+ * or registry lookups. Only built-in keyword commands can be compiled.
+ * Plans can be saved and loaded, so one compile serves many runs.
+ */
+class CommandPlan {
+public:
+    CommandPlan() = default;
+
+    // Compiles until the end of the script or the first 'exit'. Every line that
+    // fails to parse is reported in errors and left out of the plan.
+    static CommandPlan compile(std::string_view script, const CommandRegistry& registry,
+                               std::vector<PlanError>& errors);
+
+    // Binary format in host byte order; load() rejects malformed input
+    bool save(std::ostream& out) const;
+    bool load(std::istream& in);
+
+    const std::vector<PlanOp>& getOperations() const;
+    core::ArgumentSpan getArguments(const PlanOp& op) const;
+    size_t size() const;
+    bool empty() const;
+    void clear();
+
+private:
+    std::vector<PlanOp> operations_;
+    std::vector<core::CommandArgument> arguments_;  // Slots of all operations, in order
+};
+
+} // namespace slideEditor::controller
+
+#endif // COMMAND_PLAN_HPP
@@ -2,21 +2,30 @@
 #define COMMAND_REGISTRY_HPP
 
 #include "interfaces/IMetaCommand.hpp"
+#include "controller/parser/KeywordTable.hpp"
+#include <array>
 #include <memory>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace slideEditor::controller {
 
+class CommandInvoker;
+
 // Stores metadata for each command
 class CommandRegistry {
 public:
     CommandRegistry() = default;
     
     void registerCommand(std::unique_ptr<core::IMetaCommand> metaCommand);
-    const core::IMetaCommand* getMetaCommand(const std::string& name) const;
-    core::IMetaCommand* getMetaCommand(const std::string& name);
+    // Built-in keywords resolve through the perfect-hash table; other names
+    // are looked up in commands_. Neither path copies or lowercases the name.
+    const core::IMetaCommand* getMetaCommand(std::string_view name) const;
+    core::IMetaCommand* getMetaCommand(std::string_view name);
+    // Typed path of a command registered with MetaCommand::create, else null
+    const CommandInvoker* getInvoker(std::string_view name) const;
     
     // Query
     bool hasCommand(const std::string& name) const;
@@ -29,7 +38,15 @@ public:
     std::string getAllCommandsHelp() const;
 
 private:
-    std::map<std::string, std::unique_ptr<core::IMetaCommand>> commands_;
+    // Orders keys as if lowercased; transparent, so string_views need no copy
+    struct CaseInsensitiveLess {
+        using is_transparent = void;
+        bool operator()(std::string_view a, std::string_view b) const;
+    };
+    
+    std::map<std::string, std::unique_ptr<core::IMetaCommand>, CaseInsensitiveLess> commands_;
+    std::array<core::IMetaCommand*, keywords::kCount> keywordSlots_{};  // Non-owning, indexed by keyword
+    std::array<const CommandInvoker*, keywords::kCount> keywordInvokers_{};
 };
 
 } // namespace slideEditor::controller
@@ -29,6 +29,11 @@ public:
      */
     std::optional<std::string> readCommandLine();
     
+    /**
+     * Same, reusing line's storage; returns false on EOF or error
+     */
+    bool readCommandLine(std::string& line);
+    
     /**
      * Reads a single character from input
      */
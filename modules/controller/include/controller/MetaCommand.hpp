@@ -3,9 +3,12 @@
 
 #include "interfaces/IMetaCommand.hpp"
 #include "controller/CommandContext.hpp"
+#include "controller/CommandInvoker.hpp"
 #include <sstream>
 #include <algorithm>
 #include <initializer_list>
+#include <memory>
+#include <stdexcept>
 
 namespace slideEditor::controller {
 
@@ -18,6 +21,31 @@ public:
                 std::initializer_list<core::ArgumentInfo> arguments = {});
     
     virtual ~MetaCommand() = default;
+    
+    // Typed registration. factory(core::ArgumentSpan, CommandContext&) returns a
+    // Command by value; it backs both getInvoker() and the legacy getCreator().
+    template <typename Command, typename Factory>
+    static std::unique_ptr<MetaCommand> create(std::string name,
+                                               std::string description,
+                                               std::string category,
+                                               Factory factory,
+                                               std::initializer_list<core::ArgumentInfo> arguments = {}) {
+        core::CommandCreator creator = [factory](core::ArgumentSpan args, void* contextPtr)
+            -> std::unique_ptr<core::ICommand>
+        {
+            if (!contextPtr) {
+                throw std::runtime_error("Context pointer is null");
+            }
+            auto& context = *static_cast<CommandContext*>(contextPtr);
+            return std::unique_ptr<core::ICommand>(new Command(factory(args, context)));
+        };
+        
+        auto meta = std::make_unique<MetaCommand>(std::move(name), std::move(description),
+                                                  std::move(category), std::move(creator),
+                                                  arguments);
+        meta->invoker_ = std::make_unique<TypedInvoker<Command, Factory>>(std::move(factory));
+        return meta;
+    }
 
     std::string getName() const override;
     std::string getDescription() const override;
@@ -28,9 +56,13 @@ public:
     size_t getMaxArgCount() const override;
     
     bool validateArguments(const std::vector<std::string>& args) const override;
+    bool validateParsedArguments(core::ArgumentSpan args) const override;
     
     std::string getDetailedHelp() const override;
     std::string getUsage() const override;
+    
+    // Null unless registered through create()
+    const CommandInvoker* getInvoker() const;
 
 protected:
     std::string name_;
@@ -38,6 +70,7 @@ protected:
     std::string category_;
     std::vector<core::ArgumentInfo> arguments_;
     core::CommandCreator creator_;
+    std::unique_ptr<CommandInvoker> invoker_;
     
     bool validateArgumentType(const std::string& value, const std::string& type) const;
 };
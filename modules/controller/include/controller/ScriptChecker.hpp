@@ -0,0 +1,49 @@
+#ifndef SCRIPT_CHECKER_HPP
+#define SCRIPT_CHECKER_HPP
+
+#include "controller/CommandPlan.hpp"
+#include "view/WorkStealingPool.hpp"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace slideEditor::controller {
+
+class CommandRegistry;
+
+// Outcome of checking a script; errors are in line order
+struct CheckResult {
+    size_t lines = 0;
+    size_t commands = 0;      // Non-blank lines
+    std::vector<PlanError> errors;
+};
+
+/**
+ * ScriptChecker - Parse-only validation of a whole script
+ *
+ * The script is cut into chunks at line boundaries and every chunk is
+ * lexed and parsed on a WorkStealingPool against the registry's argument
+ * metadata. Nothing is executed. Each chunk numbers its lines from one;
+ * the numbers are shifted to script lines once all chunks are done.
+ * Unlike CommandPlan::compile, checking does not stop at 'exit'.
+ */
+class ScriptChecker {
+public:
+    explicit ScriptChecker(const CommandRegistry& registry);
+    
+    // pool defaults to WorkStealingPool::shared(); chunkSize 0 picks one from the pool size
+    CheckResult check(std::string_view script, view::WorkStealingPool* pool = nullptr,
+                      size_t chunkSize = 0) const;
+    
+    // Pieces of about chunkSize bytes, each ending just after a '\n' (or at the end)
+    static std::vector<std::string_view> splitChunks(std::string_view script, size_t chunkSize);
+
+private:
+    const CommandRegistry& registry_;
+    
+    CheckResult checkChunk(std::string_view chunk) const;
+};
+
+} // namespace slideEditor::controller
+
+#endif // SCRIPT_CHECKER_HPP
@@ -0,0 +1,86 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace slideEditor::controller {
+
+/**
+ * SpscQueue - Bounded lock-free queue for one producer and one consumer
+ *
+ * A ring of default-constructed slots; items are moved in and out. Each
+ * side owns one index and keeps a cached copy of the other's, so the
+ * shared indices are only read again when the ring looks full or empty.
+ * Neither call blocks: callers decide how to wait.
+ */
+template <typename T>
+class SpscQueue {
+public:
+    // Capacity is rounded up to a power of two
+    explicit SpscQueue(size_t capacity)
+        : capacity_(roundUp(capacity)), mask_(capacity_ - 1),
+          slots_(std::make_unique<T[]>(capacity_)) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer only; item is left untouched when the queue is full
+    bool tryPush(T&& item) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ == capacity_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ == capacity_) {
+                return false;
+            }
+        }
+
+        slots_[tail & mask_] = std::move(item);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    bool tryPop(T& item) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return false;
+            }
+        }
+
+        item = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const {
+        return capacity_;
+    }
+
+private:
+    static size_t roundUp(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+
+        return size;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<T[]> slots_;
+
+    // Indices only grow; each side's index and cache share a cache line
+    alignas(64) std::atomic<size_t> head_{0};  // Next slot to pop, written by the consumer
+    size_t cachedTail_ = 0;                    // Consumer's copy of tail_
+    alignas(64) std::atomic<size_t> tail_{0};  // Next slot to push, written by the producer
+    size_t cachedHead_ = 0;                    // Producer's copy of head_
+};
+
+} // namespace slideEditor::controller
+
+#endif // SPSC_QUEUE_HPP
@@ -8,6 +8,13 @@
 #include "interfaces/ISerializer.hpp"
 #include "interfaces/IView.hpp"
 #include "controller/CommandRegistry.hpp"
+#include "view/SvgFragmentCache.hpp"
+#include "view/SvgGenerator.hpp"
+#include "view/SplitExporter.hpp"
+#include "view/SvgRenderer.hpp"
+#include "view/PreviewServer.hpp"
+#include "view/raster/ImageWriter.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -32,7 +39,15 @@ private:
     std::shared_ptr<core::ISerializer> serializer_;
     std::string filename_;
 
-    std::string message_;
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        SAVED,
+        SAVE_FAILED
+    };
+    
+    Result result_;
+    std::string error_;  // Serializer's reason, kept only on failure
     bool success_;
 };
 
@@ -53,7 +68,15 @@ private:
     std::shared_ptr<core::ISerializer> serializer_;
     std::string filename_;
     
-    std::string message_;
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        LOADED,
+        LOAD_FAILED
+    };
+    
+    Result result_;
+    std::string error_;  // Serializer's reason, kept only on failure
     bool success_;
 };
 
@@ -72,7 +95,13 @@ private:
     std::shared_ptr<core::ISlideRepository> repository_;
     std::shared_ptr<core::IView> view_;
     
-    std::string message_;
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        DISPLAYED
+    };
+    
+    Result result_;
     bool success_;
 };
 
@@ -93,7 +122,15 @@ private:
     std::shared_ptr<core::IView> view_;
     std::string specificCommand_;
     
-    std::string message_;
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        ALL_SHOWN,
+        COMMAND_SHOWN,
+        UNKNOWN_COMMAND
+    };
+    
+    Result result_;
     bool success_;
 };
 
@@ -108,7 +145,12 @@ public:
     bool isAction() const override { return false; }
 
 private:
-    std::string message_;
+    enum class Result : uint8_t {
+        NONE,
+        EXITING
+    };
+    
+    Result result_;
     bool success_;
 };
 
@@ -116,7 +158,12 @@ class DrawCommand : public core::ICommand {
 public:
     DrawCommand(std::shared_ptr<core::ISlideRepository> repo,
                 std::shared_ptr<core::IView> view,
-                std::string filename = "presentation.svg");
+                std::string filename = "presentation.svg",
+                std::shared_ptr<view::SvgFragmentCache> cache = nullptr,
+                view::SvgOptions options = view::SvgOptions(),
+                int fromSlide = 0, int toSlide = 0,
+                std::shared_ptr<view::SvgRenderer> renderer = nullptr,
+                bool openBrowser = true);
     
     bool execute(core::IOutputStream& output) override;
     std::string getResultMessage() const override;
@@ -127,8 +174,182 @@ private:
     std::shared_ptr<core::ISlideRepository> repository_;
     std::shared_ptr<core::IView> view_;
     std::string filename_;
+    std::shared_ptr<view::SvgFragmentCache> cache_;  // Optional
+    view::SvgOptions options_;
+    int fromSlide_;  // 1-based, inclusive; 0 draws the whole deck
+    int toSlide_;
+    std::shared_ptr<view::SvgRenderer> renderer_;  // Optional, reused across draws
+    bool openBrowser_;  // Off while the live preview shows the deck
+    
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        INVALID_RANGE,
+        GENERATE_FAILED,
+        GENERATED,        // Browser not opened; the live preview shows it
+        OPENED,
+        OPEN_FAILED
+    };
+    
+    Result result_;
+    size_t slideCount_;  // Deck size when the range was rejected
+    bool success_;
+};
+
+// Writes the deck as fixed-size pages: <basename>-1.svg, <basename>-2.svg, ...
+class DrawPagesCommand : public core::ICommand {
+public:
+    DrawPagesCommand(std::shared_ptr<core::ISlideRepository> repo,
+                     std::string basename, int pageSize,
+                     std::shared_ptr<view::SvgFragmentCache> cache = nullptr,
+                     view::SvgOptions options = view::SvgOptions(),
+                     std::shared_ptr<view::SvgRenderer> renderer = nullptr);
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+    static std::string pageFilename(const std::string& basename, size_t page);
+
+private:
+    std::shared_ptr<core::ISlideRepository> repository_;
+    std::string basename_;
+    int pageSize_;
+    std::shared_ptr<view::SvgFragmentCache> cache_;  // Optional
+    view::SvgOptions options_;
+    std::shared_ptr<view::SvgRenderer> renderer_;    // Optional, reused across pages
+    
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        INVALID_PAGE_SIZE,
+        PAGE_FAILED,
+        GENERATED
+    };
+    
+    Result result_;
+    size_t pageCount_;   // Pages written, or the 1-based page that failed
+    bool success_;
+};
+
+// Writes one SVG per slide plus index.html into a directory, skipping unchanged slides
+class DrawSplitCommand : public core::ICommand {
+public:
+    DrawSplitCommand(std::shared_ptr<core::ISlideRepository> repo,
+                     std::shared_ptr<view::SplitExporter> exporter,
+                     std::string directory,
+                     view::SvgOptions options = view::SvgOptions());
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+private:
+    std::shared_ptr<core::ISlideRepository> repository_;
+    std::shared_ptr<view::SplitExporter> exporter_;
+    std::string directory_;
+    view::SvgOptions options_;
+    
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        EXPORT_FAILED,
+        EXPORTED
+    };
+    
+    Result result_;
+    view::SplitExportStats stats_;
+    bool success_;
+};
+
+// Rasterizes slides to a PNG or PPM image without a browser
+class ExportCommand : public core::ICommand {
+public:
+    ExportCommand(std::shared_ptr<core::ISlideRepository> repo,
+                  std::string filename,
+                  view::ImageFormat format = view::ImageFormat::PNG,
+                  int fromSlide = 0, int toSlide = 0,
+                  view::LayoutMode layout = view::LayoutMode::GRID);
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+private:
+    std::shared_ptr<core::ISlideRepository> repository_;
+    std::string filename_;
+    view::ImageFormat format_;
+    int fromSlide_;  // 1-based, inclusive; 0 exports the whole deck
+    int toSlide_;
+    view::LayoutMode layout_;  // As set by svgmode, so export matches draw
+    
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        INVALID_RANGE,
+        WRITE_FAILED,
+        GENERATED
+    };
+    
+    Result result_;
+    size_t slideCount_;  // Deck size when the range was rejected
+    bool success_;
+};
+
+// Starts the live preview server (if needed) and publishes the current deck
+class PreviewCommand : public core::ICommand {
+public:
+    PreviewCommand(std::shared_ptr<core::ISlideRepository> repo,
+                   std::shared_ptr<view::PreviewServer> server,
+                   int port = view::PreviewServer::DEFAULT_PORT);
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+private:
+    std::shared_ptr<core::ISlideRepository> repository_;
+    std::shared_ptr<view::PreviewServer> server_;
+    int port_;
+    
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        INVALID_PORT,
+        START_FAILED,
+        STARTED
+    };
+    
+    Result result_;
+    bool success_;
+};
+
+// Selects the SVG output mode used by subsequent draws
+class SvgModeCommand : public core::ICommand {
+public:
+    SvgModeCommand(std::shared_ptr<view::SvgOptions> options, std::string mode);
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+private:
+    std::shared_ptr<view::SvgOptions> options_;
+    std::string mode_;
+    
+    enum class Result : uint8_t {
+        NONE,
+        NO_COMPONENTS,
+        UNKNOWN_MODE,
+        MODE_SET
+    };
     
-    std::string message_;
+    Result result_;
     bool success_;
 };
 
@@ -4,6 +4,7 @@
 #include "interfaces/ICommand.hpp"
 #include "controller/CommandHistory.hpp"
 #include "interfaces/IView.hpp"
+#include <cstdint>
 #include <string>
 
 namespace slideEditor::controller {
@@ -22,7 +23,17 @@ private:
     std::shared_ptr<CommandHistory> history_;
     std::shared_ptr<core::IView> view_;
     
-    std::string message_;
+    enum class Result : uint8_t {
+        NONE,
+        NO_HISTORY,
+        GROUP_OPEN,
+        NOTHING_TO_UNDO,
+        UNDONE,
+        UNDO_FAILED
+    };
+    
+    Result result_;
+    std::string description_;  // Of the undone action, taken before history moves it
     bool success_;
 };
 
@@ -40,8 +51,92 @@ private:
     std::shared_ptr<CommandHistory> history_;
     std::shared_ptr<core::IView> view_;
     
+    enum class Result : uint8_t {
+        NONE,
+        NO_HISTORY,
+        GROUP_OPEN,
+        NOTHING_TO_REDO,
+        REDONE,
+        REDO_FAILED
+    };
+    
+    bool success_;
+    Result result_;
+    std::string description_;  // Of the redone action
+};
+
+// Opens a transaction: later actions join one undo entry
+class BeginCommand : public core::ICommand {
+public:
+    explicit BeginCommand(std::shared_ptr<CommandHistory> history);
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+private:
+    std::shared_ptr<CommandHistory> history_;
+    
+    enum class Result : uint8_t {
+        NONE,
+        NO_HISTORY,
+        ALREADY_OPEN,
+        STARTED
+    };
+    
+    bool success_;
+    Result result_;
+};
+
+// Closes the transaction and records its actions as one undo entry
+class CommitCommand : public core::ICommand {
+public:
+    explicit CommitCommand(std::shared_ptr<CommandHistory> history);
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+private:
+    std::shared_ptr<CommandHistory> history_;
+    
+    enum class Result : uint8_t {
+        NONE,
+        NOT_OPEN,
+        COMMITTED
+    };
+    
+    bool success_;
+    Result result_;
+    size_t count_;  // Actions committed
+};
+
+// Closes the transaction and undoes its actions
+class RollbackCommand : public core::ICommand {
+public:
+    explicit RollbackCommand(std::shared_ptr<CommandHistory> history);
+    
+    bool execute(core::IOutputStream& output) override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    bool isAction() const override { return false; }
+
+private:
+    std::shared_ptr<CommandHistory> history_;
+    
+    enum class Result : uint8_t {
+        NONE,
+        NOT_OPEN,
+        ROLLED_BACK,
+        PARTIAL
+    };
+    
     bool success_;
-    std::string message_;
+    Result result_;
+    size_t count_;   // Actions in the transaction
+    size_t undone_;
 };
 
 } // namespace slideEditor::controller
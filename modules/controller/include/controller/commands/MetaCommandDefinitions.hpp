@@ -26,6 +26,14 @@ std::unique_ptr<core::IMetaCommand> createDisplayMetaCommand();
 std::unique_ptr<core::IMetaCommand> createHelpMetaCommand();
 std::unique_ptr<core::IMetaCommand> createExitMetaCommand();
 std::unique_ptr<core::IMetaCommand> createDrawMetaCommand();
+std::unique_ptr<core::IMetaCommand> createDrawPagesMetaCommand();
+std::unique_ptr<core::IMetaCommand> createDrawSplitMetaCommand();
+std::unique_ptr<core::IMetaCommand> createExportMetaCommand();
+std::unique_ptr<core::IMetaCommand> createSvgModeMetaCommand();
+std::unique_ptr<core::IMetaCommand> createPreviewMetaCommand();
+std::unique_ptr<core::IMetaCommand> createBeginMetaCommand();
+std::unique_ptr<core::IMetaCommand> createCommitMetaCommand();
+std::unique_ptr<core::IMetaCommand> createRollbackMetaCommand();
 
 } // namespace slideEditor::controller
 
@@ -0,0 +1,23 @@
+#ifndef RESULT_OUTPUT_HPP
+#define RESULT_OUTPUT_HPP
+
+#include "interfaces/ICommand.hpp"
+#include "interfaces/IOutputStream.hpp"
+
+namespace slideEditor::controller {
+
+// Writes the result of a finished command: a failure always, as "[ERROR] <message>",
+// anything else only if output is not quiet. Commands keep a result code and render
+// text in getResultMessage(), so a quiet run formats nothing for commands that succeed.
+inline void writeResult(const core::ICommand& command, core::IOutputStream& output) {
+    if (!command.wasSuccessful()) {
+        output.writeLine("[ERROR] " + command.getResultMessage());
+    }
+    else if (output.getVerbosity() != core::Verbosity::QUIET) {
+        output.writeLine(command.getResultMessage());
+    }
+}
+
+} // namespace slideEditor::controller
+
+#endif // RESULT_OUTPUT_HPP
@@ -5,6 +5,7 @@
 #include "interfaces/ISlideRepository.hpp"
 #include "interfaces/IOutputStream.hpp"
 #include "interfaces/IShape.hpp"
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <vector>
@@ -31,7 +32,16 @@ private:
     std::string content_;
     std::string theme_;
     
-    std::string message_;
+    // Rendered by getResultMessage() only when someone asks for it
+    enum class Result : uint8_t {
+        NONE,
+        NO_REPOSITORY,
+        CREATED,
+        CREATE_FAILED,
+        UNDONE
+    };
+    
+    Result result_;
     int createdId_;
     bool executed_;
     bool success_;
@@ -61,10 +71,19 @@ private:
     std::string fillColor_;
     double scale_;
 
+    enum class Result : uint8_t {
+        NONE,
+        NO_REPOSITORY,
+        SLIDE_NOT_FOUND,
+        INVALID_SHAPE,
+        ADDED,
+        UNDONE
+    };
+    
     size_t addedShapeIndex_;
     bool executed_;
     bool success_;
-    std::string message_;
+    Result result_;
 };
 
 class UndoableRemoveShapeCommand : public core::IUndoableCommand {
@@ -85,10 +104,49 @@ private:
     int slideId_;
     size_t shapeIndex_;
     
+    enum class Result : uint8_t {
+        NONE,
+        NO_REPOSITORY,
+        SLIDE_NOT_FOUND,
+        INDEX_OUT_OF_RANGE,
+        REMOVED,
+        REMOVE_FAILED,
+        UNDONE
+    };
+    
     std::unique_ptr<core::IShape> removedShape_;  // Store for undo
     bool executed_;
     bool success_;
-    std::string message_;
+    Result result_;
+};
+
+// Actions committed together by 'begin' ... 'commit'; one undo step for all
+class UndoableGroupCommand : public core::IUndoableCommand {
+public:
+    // The actions have already been executed
+    explicit UndoableGroupCommand(std::vector<std::unique_ptr<core::IUndoableCommand>> actions);
+    
+    bool execute(core::IOutputStream& output) override;  // Redoes every action in order
+    bool undo() override;                                 // Undoes them in reverse order
+    bool canUndo() const override;
+    std::string getDescription() const override;
+    std::string getResultMessage() const override;
+    bool wasSuccessful() const override;
+    
+    size_t getActionCount() const;
+
+private:
+    enum class Result : uint8_t {
+        NONE,
+        APPLIED,
+        REDO_FAILED,
+        UNDONE
+    };
+    
+    std::vector<std::unique_ptr<core::IUndoableCommand>> actions_;
+    bool executed_;
+    bool success_;
+    Result result_;
 };
 
 } // namespace slideEdior::controller
@@ -2,61 +2,20 @@
 #define COMMAND_PARSER_HPP
 
 #include "Lexer.hpp"
+#include "SpanLexer.hpp"
 #include "Token.hpp"
+#include "interfaces/IMetaCommand.hpp"
 #include <vector>
 #include <string>
 #include <memory>
+#include <string_view>
 
 namespace slideEditor::controller {
 
 class CommandRegistry;  // Forward declare
 
-struct ParsedArgument {
-    std::variant<int, double, std::string> value;
-    std::string type;  // "int", "double", "string"
-    
-    ParsedArgument() : value(std::string("")), type("string") {}
-    
-    explicit ParsedArgument(int v) : value(v), type("int") {}
-    explicit ParsedArgument(double v) : value(v), type("double") {}
-    explicit ParsedArgument(std::string v) : value(std::move(v)), type("string") {}
-    
-    int asInt() const {
-        if (std::holds_alternative<int>(value)) {
-            return std::get<int>(value);
-        } 
-        else if (std::holds_alternative<double>(value)) {
-            return static_cast<int>(std::get<double>(value));
-        } 
-        else {
-            return std::stoi(std::get<std::string>(value));
-        }
-    }
-    
-    double asDouble() const {
-        if (std::holds_alternative<double>(value)) {
-            return std::get<double>(value);
-        } 
-        else if (std::holds_alternative<int>(value)) {
-            return static_cast<double>(std::get<int>(value));
-        } 
-        else {
-            return std::stod(std::get<std::string>(value));
-        }
-    }
-    
-    std::string asString() const {
-        if (std::holds_alternative<std::string>(value)) {
-            return std::get<std::string>(value);
-        } 
-        else if (std::holds_alternative<int>(value)) {
-            return std::to_string(std::get<int>(value));
-        } 
-        else {
-            return std::to_string(std::get<double>(value));
-        }
-    }
-};
+// Parsed values are handed to command creators as they are
+using ParsedArgument = core::CommandArgument;
 
 struct ParsedCommand {
     std::vector<ParsedArgument> arguments;
@@ -80,13 +39,20 @@ struct ParsedCommand {
 class CommandParser {
 public:
     explicit CommandParser(core::IInputStream* input);
+    // Parses caller-owned text given to reset(text) with a SpanLexer
+    CommandParser();
     
     void setRegistry(CommandRegistry* registry);  
+    // Rereads the input from its current position, e.g. after it was reset over a new line
+    void reset();
+    // Switches to the SpanLexer over text, which must outlive the parse
+    void reset(std::string_view text);
     ParsedCommand parseCommand();
     std::vector<ParsedCommand> parseAll();
 
 private:
-    std::unique_ptr<Lexer> lexer_;
+    std::unique_ptr<Lexer> lexer_;  // Null when parsing a span
+    SpanLexer spanLexer_;
     Token currentToken_;
     CommandRegistry* registry_;  
     
@@ -0,0 +1,136 @@
+#ifndef KEYWORD_TABLE_HPP
+#define KEYWORD_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace slideEditor::controller::keywords {
+
+// Built-in command keywords. The lexer reports these as COMMAND tokens and the
+// registry keeps a direct slot for each, so neither has to lowercase a copy.
+// New keywords go at the end: compiled CommandPlans store these indices.
+inline constexpr std::array<std::string_view, 19> kNames = {
+    "create", "addshape", "removeshape", "save",
+    "load", "display", "help", "draw", "exit", "undo", "redo",
+    "svgmode", "drawpages", "drawsplit", "export", "preview",
+    "begin", "commit", "rollback"
+};
+
+inline constexpr size_t kCount = kNames.size();
+inline constexpr int kNotFound = -1;
+
+constexpr char fold(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+constexpr bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (fold(a[i]) != fold(b[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// FNV-1a over case-folded characters, with the offset basis perturbed by seed
+constexpr uint32_t hash(std::string_view word, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (char c : word) {
+        h ^= static_cast<unsigned char>(fold(c));
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+namespace detail {
+
+inline constexpr size_t kTableSize = 128;  // Power of two, over six times kCount
+inline constexpr uint32_t kTableMask = kTableSize - 1;
+
+constexpr bool isCollisionFree(uint32_t seed) {
+    std::array<bool, kTableSize> used{};
+    for (const auto& name : kNames) {
+        const uint32_t slot = hash(name, seed) & kTableMask;
+        if (used[slot]) {
+            return false;
+        }
+        used[slot] = true;
+    }
+
+    return true;
+}
+
+constexpr uint32_t findSeed() {
+    for (uint32_t seed = 0; seed < 100000; ++seed) {
+        if (isCollisionFree(seed)) {
+            return seed;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+inline constexpr uint32_t kSeed = findSeed();
+static_assert(kSeed != UINT32_MAX, "no perfect hash seed for the keyword set");
+
+constexpr size_t maxLength() {
+    size_t longest = 0;
+    for (const auto& name : kNames) {
+        longest = name.size() > longest ? name.size() : longest;
+    }
+
+    return longest;
+}
+
+inline constexpr size_t kMaxLength = maxLength();
+
+// Slot -> keyword index, or kNotFound for empty slots
+constexpr std::array<int8_t, kTableSize> buildTable() {
+    std::array<int8_t, kTableSize> table{};
+    for (auto& slot : table) {
+        slot = kNotFound;
+    }
+
+    for (size_t i = 0; i < kCount; ++i) {
+        table[hash(kNames[i], kSeed) & kTableMask] = static_cast<int8_t>(i);
+    }
+
+    return table;
+}
+
+inline constexpr std::array<int8_t, kTableSize> kTable = buildTable();
+
+} // namespace detail
+
+// Index of word in kNames, matched case-insensitively, or kNotFound
+constexpr int find(std::string_view word) {
+    if (word.empty() || word.size() > detail::kMaxLength) {
+        return kNotFound;
+    }
+
+    const int index = detail::kTable[hash(word, detail::kSeed) & detail::kTableMask];
+    if (index == kNotFound || !equalsIgnoreCase(word, kNames[index])) {
+        return kNotFound;
+    }
+
+    return index;
+}
+
+constexpr bool isKeyword(std::string_view word) {
+    return find(word) != kNotFound;
+}
+
+static_assert(find("addshape") == 1 && find("AddShape") == 1 && find("add") == kNotFound,
+              "keyword table lookup");
+
+} // namespace slideEditor::controller::keywords
+
+#endif // KEYWORD_TABLE_HPP
@@ -17,6 +17,8 @@ public:
     // Peek at next token without consuming
     Token peekToken();
     std::vector<Token> tokenizeAll();
+    // Starts over at line 1; call after pointing the input at new text
+    void reset();
     size_t getLine() const;
     size_t getColumn() const;
 
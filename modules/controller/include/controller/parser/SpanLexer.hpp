@@ -0,0 +1,66 @@
+#ifndef SPAN_LEXER_HPP
+#define SPAN_LEXER_HPP
+
+#include "Token.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace slideEditor::controller {
+
+// Token as a slice of the lexed text; numbers are already converted
+struct SpanToken {
+    TokenType type = TokenType::END_OF_FILE;
+    size_t offset = 0;          // Start of the token in the text
+    uint32_t length = 0;
+    uint32_t line = 0;
+    uint32_t column = 0;
+    int keyword = -1;           // keywords:: index for COMMAND tokens
+    bool isInteger = false;     // NUMBER: intValue is exact
+    int intValue = 0;
+    double doubleValue = 0.0;
+    const char* error = nullptr;  // ERROR: static message
+};
+
+/**
+ * SpanLexer - Lexer over a contiguous buffer owned by the caller
+ *
+ * Accepts the same language as Lexer but reads characters directly instead
+ * of through IInputStream, produces offset/length tokens instead of copied
+ * strings and converts numbers with std::from_chars. The text (a line, a
+ * whole script or a mapped file) must outlive the lexer and its tokens.
+ */
+class SpanLexer {
+public:
+    SpanLexer() = default;
+    explicit SpanLexer(std::string_view text);
+
+    // Starts over at line 1 of new text
+    void reset(std::string_view text);
+    SpanToken nextToken();
+    std::vector<SpanToken> tokenizeAll();
+
+    std::string_view text() const;
+    std::string_view textOf(const SpanToken& token) const;
+    // Converts to the owning token type used by CommandParser
+    Token toToken(const SpanToken& token) const;
+
+    size_t getLine() const;
+    size_t getColumn() const;
+
+private:
+    std::string_view text_;
+    size_t position_ = 0;
+    size_t line_ = 1;
+    size_t column_ = 1;
+
+    SpanToken makeToken(TokenType type, size_t start, size_t startColumn) const;
+    SpanToken makeError(const char* message, size_t start, size_t startColumn) const;
+    SpanToken lexIdentifier(size_t start, size_t startColumn);
+    SpanToken lexNumber(size_t start, size_t startColumn);
+};
+
+} // namespace slideEditor::controller
+
+#endif // SPAN_LEXER_HPP
@@ -26,11 +26,31 @@ void CommandContext::setRegistry(CommandRegistry* registry) {
     registry_ = registry;
 }
 
+void CommandContext::setRenderCache(std::shared_ptr<view::SvgFragmentCache> cache) {
+    renderCache_ = cache;
+}
+
+void CommandContext::setRenderOptions(std::shared_ptr<view::SvgOptions> options) {
+    renderOptions_ = options;
+}
+
+void CommandContext::setSplitExporter(std::shared_ptr<view::SplitExporter> exporter) {
+    splitExporter_ = exporter;
+}
+
+void CommandContext::setRenderer(std::shared_ptr<view::SvgRenderer> renderer) {
+    renderer_ = renderer;
+}
+
+void CommandContext::setPreviewServer(std::shared_ptr<view::PreviewServer> server) {
+    previewServer_ = server;
+}
+
 bool CommandContext::hasRepository() const {
     return repository_ != nullptr;
 }
 
-std::shared_ptr<core::ISlideRepository> CommandContext::getRepository() const {
+const std::shared_ptr<core::ISlideRepository>& CommandContext::getRepository() const {
     return repository_;
 }
 
@@ -38,7 +58,7 @@ bool CommandContext::hasSerializer() const {
     return serializer_ != nullptr;
 }
 
-std::shared_ptr<core::ISerializer> CommandContext::getSerializer() const {
+const std::shared_ptr<core::ISerializer>& CommandContext::getSerializer() const {
     return serializer_;
 }
 
@@ -46,7 +66,7 @@ bool CommandContext::hasView() const {
     return view_ != nullptr;
 }
 
-std::shared_ptr<core::IView> CommandContext::getView() const {
+const std::shared_ptr<core::IView>& CommandContext::getView() const {
     return view_;
 }
 
@@ -123,7 +143,7 @@ std::string CommandContext::getMissingDependencies() const {
 }
 
 
-std::shared_ptr<CommandHistory> CommandContext::getHistoryTyped() const {
+const std::shared_ptr<CommandHistory>& CommandContext::getHistoryTyped() const {
     return history_;
 }
 
@@ -131,4 +151,44 @@ CommandRegistry* CommandContext::getRegistryTyped() const {
     return registry_;
 }
 
+bool CommandContext::hasRenderCache() const {
+    return renderCache_ != nullptr;
+}
+
+const std::shared_ptr<view::SvgFragmentCache>& CommandContext::getRenderCache() const {
+    return renderCache_;
+}
+
+bool CommandContext::hasRenderOptions() const {
+    return renderOptions_ != nullptr;
+}
+
+const std::shared_ptr<view::SvgOptions>& CommandContext::getRenderOptions() const {
+    return renderOptions_;
+}
+
+bool CommandContext::hasSplitExporter() const {
+    return splitExporter_ != nullptr;
+}
+
+const std::shared_ptr<view::SplitExporter>& CommandContext::getSplitExporter() const {
+    return splitExporter_;
+}
+
+bool CommandContext::hasRenderer() const {
+    return renderer_ != nullptr;
+}
+
+const std::shared_ptr<view::SvgRenderer>& CommandContext::getRenderer() const {
+    return renderer_;
+}
+
+bool CommandContext::hasPreviewServer() const {
+    return previewServer_ != nullptr;
+}
+
+const std::shared_ptr<view::PreviewServer>& CommandContext::getPreviewServer() const {
+    return previewServer_;
+}
+
 } // namespace slideEditor::controller
\ No newline at end of file
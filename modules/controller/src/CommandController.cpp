@@ -1,32 +1,109 @@
 #include "controller/CommandController.hpp"
 #include "controller/InputHandler.hpp"
 #include "controller/parser/CommandParser.hpp"
+#include "controller/parser/KeywordTable.hpp"
+#include "controller/SpscQueue.hpp"
 #include "controller/commands/MetaCommandDefinitions.hpp"
 #include "io/InputStream.hpp"
 #include "io/OutputStream.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <sstream>
 #include <memory>
+#include <mutex>
 #include <iostream>
+#include <thread>
 
 namespace slideEditor::controller {
 
+namespace {
+
+constexpr size_t PIPELINE_CAPACITY = 1024;
+constexpr int PIPELINE_SPINS = 64;  // Yields before a pipeline side goes to sleep
+
+// One input line on its way from the reader thread to the executor
+struct PipelineItem {
+    size_t line = 0;
+    ParsedCommand parsed;
+    const core::IMetaCommand* metaCmd = nullptr;  // Null if unknown or invalid
+    const CommandInvoker* invoker = nullptr;      // Null if metaCmd has no typed path
+    std::string error;                            // Exception thrown while parsing
+};
+
+// Where one side of the pipeline sleeps until the other makes progress.
+// wait() spins briefly, then blocks; notify() only takes the lock when the
+// waiter is actually parked, so a busy pipeline never touches the mutex.
+class Parker {
+public:
+    // ready is retried until it returns true; it runs under the lock once parked
+    template <typename Ready>
+    void wait(Ready ready) {
+        for (int i = 0; i < PIPELINE_SPINS; ++i) {
+            if (ready()) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+        
+        std::unique_lock<std::mutex> lock(mutex_);
+        parked_.store(true, std::memory_order_relaxed);
+        // Pairs with notify(): either ready() sees the progress or notify() sees parked_
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condition_.wait(lock, ready);
+        parked_.store(false, std::memory_order_relaxed);
+    }
+    
+    // Call after making progress the waiter may be waiting for
+    void notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_.load(std::memory_order_relaxed)) {
+            // The waiter holds the lock until it sleeps, so this cannot slip in between
+            { std::lock_guard<std::mutex> lock(mutex_); }
+            condition_.notify_one();
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::atomic<bool> parked_{false};
+};
+
+} // namespace
+
 CommandController::CommandController(std::shared_ptr<core::ISlideRepository> repo,
                                      std::shared_ptr<core::ISerializer> serializer,
                                      std::shared_ptr<core::IView> view,
                                      std::shared_ptr<core::IInputStream> input)
     : repository_(repo), serializer_(serializer), view_(view), 
-      input_(input), running_(false) {
+      input_(input), commandOutput_(std::make_shared<io::OutputStream>(std::cout)),
+      discardedOutput_(nullptr),
+      groupOutput_(discardedOutput_), running_(false) {
     
+    groupOutput_.setVerbosity(core::Verbosity::QUIET);  // Nothing shown, so nothing formatted
     commandHistory_ = std::make_shared<CommandHistory>(100);
     commandRegistry_ = std::make_unique<CommandRegistry>();
+    renderCache_ = std::make_shared<view::SvgFragmentCache>();
+    renderOptions_ = std::make_shared<view::SvgOptions>();
+    splitExporter_ = std::make_shared<view::SplitExporter>();
+    renderer_ = std::make_shared<view::SvgRenderer>();
+    previewServer_ = std::make_shared<view::PreviewServer>();
     
-    context_.repository = &repository_;
-    context_.serializer = &serializer_;
-    context_.view = &view_;
-    context_.history = &commandHistory_;
-    context_.commandRegistry = commandRegistry_.get();
+    context_.setRepository(repository_);
+    context_.setSerializer(serializer_);
+    context_.setView(view_);
+    context_.setHistory(commandHistory_);
+    context_.setRegistry(commandRegistry_.get());
+    context_.setRenderCache(renderCache_);
+    context_.setRenderOptions(renderOptions_);
+    context_.setSplitExporter(splitExporter_);
+    context_.setRenderer(renderer_);
+    context_.setPreviewServer(previewServer_);
     
     initializeCommands();
+    parser_.setRegistry(commandRegistry_.get());  // for generic parsing
 }
 
 void CommandController::initializeCommands() {
@@ -41,6 +118,34 @@ void CommandController::initializeCommands() {
     commandRegistry_->registerCommand(createHelpMetaCommand());
     commandRegistry_->registerCommand(createExitMetaCommand());
     commandRegistry_->registerCommand(createDrawMetaCommand());
+    commandRegistry_->registerCommand(createDrawPagesMetaCommand());
+    commandRegistry_->registerCommand(createDrawSplitMetaCommand());
+    commandRegistry_->registerCommand(createExportMetaCommand());
+    commandRegistry_->registerCommand(createSvgModeMetaCommand());
+    commandRegistry_->registerCommand(createPreviewMetaCommand());
+    commandRegistry_->registerCommand(createBeginMetaCommand());
+    commandRegistry_->registerCommand(createCommitMetaCommand());
+    commandRegistry_->registerCommand(createRollbackMetaCommand());
+}
+
+void CommandController::setOutput(std::shared_ptr<core::IOutputStream> output) {
+    commandOutput_ = std::move(output);
+}
+
+void CommandController::flushOutput() {
+    commandOutput_->flush();
+    view_->flush();
+}
+
+bool CommandController::rollbackOpenGroup() {
+    if (!commandHistory_->isGroupOpen()) {
+        return false;
+    }
+    
+    // An unfinished transaction is never applied
+    const size_t undone = commandHistory_->rollbackGroup();
+    view_->displayError("Transaction left open; rolled back " + std::to_string(undone) + " actions");
+    return true;
 }
 
 void CommandController::run() {
@@ -49,7 +154,7 @@ void CommandController::run() {
     view_->displayMessage("Type 'help' for available commands, 'exit' to quit.");
     view_->displayMessage("═══════════════════════════════════════════════════");
     view_->displayMessage("ACTIONS (can be undone): create, addshape, removeshape");
-    view_->displayMessage("META-COMMANDS: undo, redo");
+    view_->displayMessage("META-COMMANDS: undo, redo, begin, commit, rollback");
     view_->displayMessage("═══════════════════════════════════════════════════\n");
     InputHandler inputHandler(input_.get());
     while (running_ && inputHandler.hasMoreInput()) {
@@ -72,44 +177,328 @@ void CommandController::run() {
             continue;
         }
         
-        bool continueRunning = processCommandLine(commandLine);
-        if (!continueRunning) {
+        if (processCommandLine(commandLine) == LineStatus::EXIT) {
             running_ = false;
         }
     }
     
+    rollbackOpenGroup();
     view_->displayMessage("\nGoodbye!");
+    flushOutput();
 }
 
 bool CommandController::processCommand(const std::string& commandLine) {
-    return processCommandLine(commandLine);
+    return processCommandLine(commandLine) != LineStatus::EXIT;
 }
 
-bool CommandController::processCommandLine(const std::string& commandLine) {
-    auto stream = std::make_shared<io::InputStream>(commandLine);
-    CommandParser parser(stream.get());
-    parser.setRegistry(commandRegistry_.get());  // for generic parsing
-    ParsedCommand parsed = parser.parseCommand();
+BatchStats CommandController::runBatch(bool stopOnError) {
+    BatchStats stats;
+    const auto start = std::chrono::steady_clock::now();
+    InputHandler inputHandler(input_.get());
+    if (inputHandler.hasError()) {
+        view_->displayError(inputHandler.getErrorMessage());
+        stats.failures = 1;
+        stats.stopped = true;
+        return stats;
+    }
+    
+    std::string commandLine;  // Reused for every line
+    while (inputHandler.hasMoreInput()) {
+        if (!inputHandler.readCommandLine(commandLine)) {
+            continue;  // Trailing blank lines; the loop ends at EOF
+        }
+        
+        // The handler has moved past the line's newline unless the line ended at EOF
+        const size_t line = inputHandler.isEOF() ? inputHandler.getCurrentLine()
+                                                 : inputHandler.getCurrentLine() - 1;
+        stats.commands++;
+        LineStatus status = LineStatus::FAILED;
+        try {
+            status = processCommandLine(commandLine);
+        } catch (const std::exception& e) {
+            view_->displayError("Line " + std::to_string(line) + ": " + e.what());
+        }
+        
+        if (status == LineStatus::EXIT) {
+            break;
+        }
+        if (status == LineStatus::FAILED) {
+            stats.failures++;
+            if (stats.firstFailedLine == 0) {
+                stats.firstFailedLine = line;
+            }
+            if (stopOnError) {
+                stats.stopped = true;
+                break;
+            }
+        }
+    }
+    
+    if (rollbackOpenGroup()) {
+        stats.failures++;
+    }
+    flushOutput();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+BatchStats CommandController::runPipelined(bool stopOnError) {
+    BatchStats stats;
+    const auto start = std::chrono::steady_clock::now();
+    InputHandler inputHandler(input_.get());
+    if (inputHandler.hasError()) {
+        view_->displayError(inputHandler.getErrorMessage());
+        stats.failures = 1;
+        stats.stopped = true;
+        return stats;
+    }
+    
+    SpscQueue<PipelineItem> queue(PIPELINE_CAPACITY);
+    std::atomic<bool> produced{false};   // Reader: every item is in the queue
+    std::atomic<bool> cancelled{false};  // Executor: stop reading
+    Parker itemReady;   // Executor waits here for an item or the end of input
+    Parker slotReady;   // Reader waits here for room in the queue or cancellation
+    
+    // Reader: reads, parses and resolves lines; never touches the view or the model
+    std::thread reader([&] {
+        CommandParser parser;
+        parser.setRegistry(commandRegistry_.get());
+        std::string commandLine;
+        while (!cancelled.load(std::memory_order_relaxed) && inputHandler.hasMoreInput()) {
+            if (!inputHandler.readCommandLine(commandLine)) {
+                continue;
+            }
+            
+            PipelineItem item;
+            item.line = inputHandler.isEOF() ? inputHandler.getCurrentLine()
+                                             : inputHandler.getCurrentLine() - 1;
+            try {
+                parser.reset(commandLine);
+                item.parsed = parser.parseCommand();
+                if (item.parsed.isValid) {
+                    item.metaCmd = commandRegistry_->getMetaCommand(item.parsed.commandName);
+                    item.invoker = commandRegistry_->getInvoker(item.parsed.commandName);
+                }
+            } catch (const std::exception& e) {
+                item.error = e.what();
+            }
+            
+            const bool isExit = item.parsed.isValid && item.parsed.commandName == "exit";
+            bool pushed = false;
+            slotReady.wait([&] {
+                pushed = queue.tryPush(std::move(item));  // Left untouched when full
+                return pushed || cancelled.load(std::memory_order_relaxed);
+            });
+            if (pushed) {
+                itemReady.notify();
+            }
+            
+            if (isExit) {
+                break;  // Nothing after 'exit' runs
+            }
+        }
+        
+        produced.store(true, std::memory_order_release);
+        itemReady.notify();
+    });
+    
+    // Executor: runs items in input order with runBatch's semantics
+    PipelineItem item;
+    while (true) {
+        bool popped = false;
+        itemReady.wait([&] {
+            popped = queue.tryPop(item);
+            return popped || produced.load(std::memory_order_acquire);
+        });
+        if (!popped && !queue.tryPop(item)) {
+            break;  // Drained after the reader finished
+        }
+        slotReady.notify();
+        
+        stats.commands++;
+        LineStatus status = LineStatus::FAILED;
+        if (!item.error.empty()) {
+            view_->displayError("Line " + std::to_string(item.line) + ": " + item.error);
+        }
+        else {
+            try {
+                status = dispatchCommand(item.parsed, item.metaCmd, item.invoker);
+            } catch (const std::exception& e) {
+                view_->displayError("Line " + std::to_string(item.line) + ": " + e.what());
+            }
+        }
+        
+        if (status == LineStatus::EXIT) {
+            break;
+        }
+        if (status == LineStatus::FAILED) {
+            stats.failures++;
+            if (stats.firstFailedLine == 0) {
+                stats.firstFailedLine = item.line;
+            }
+            if (stopOnError) {
+                stats.stopped = true;
+                break;
+            }
+        }
+    }
+    
+    cancelled.store(true, std::memory_order_relaxed);
+    slotReady.notify();
+    reader.join();
+    
+    if (rollbackOpenGroup()) {
+        stats.failures++;
+    }
+    flushOutput();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+BatchStats CommandController::runPlan(const CommandPlan& plan, bool stopOnError) {
+    BatchStats stats;
+    const auto start = std::chrono::steady_clock::now();
+    
+    // Resolve every opcode once; the plan only holds keyword indices
+    std::array<const core::IMetaCommand*, keywords::kCount> commands{};
+    std::array<const CommandInvoker*, keywords::kCount> invokers{};
+    for (size_t i = 0; i < keywords::kCount; ++i) {
+        commands[i] = commandRegistry_->getMetaCommand(keywords::kNames[i]);
+        invokers[i] = commandRegistry_->getInvoker(keywords::kNames[i]);
+    }
+    
+    constexpr int EXIT_OPCODE = keywords::find("exit");
+    for (const auto& op : plan.getOperations()) {
+        stats.commands++;
+        LineStatus status = LineStatus::FAILED;
+        const auto* metaCmd = commands[op.opcode];
+        const core::ArgumentSpan arguments = plan.getArguments(op);
+        try {
+            if (!metaCmd) {
+                view_->displayError("Unknown command: " + std::string(keywords::kNames[op.opcode]));
+            }
+            // A loaded plan is untrusted; hold it to the same metadata as parsed input
+            else if (!metaCmd->validateParsedArguments(arguments)) {
+                view_->displayError("Line " + std::to_string(op.line) +
+                                    ": Invalid arguments for command: " + metaCmd->getName());
+            }
+            else {
+                status = executeCommand(*metaCmd, invokers[op.opcode], arguments,
+                                        op.opcode == EXIT_OPCODE);
+            }
+        } catch (const std::exception& e) {
+            view_->displayError("Line " + std::to_string(op.line) + ": " + e.what());
+        }
+        
+        if (status == LineStatus::EXIT) {
+            break;
+        }
+        if (status == LineStatus::FAILED) {
+            stats.failures++;
+            if (stats.firstFailedLine == 0) {
+                stats.firstFailedLine = op.line;
+            }
+            if (stopOnError) {
+                stats.stopped = true;
+                break;
+            }
+        }
+    }
+    
+    if (rollbackOpenGroup()) {
+        stats.failures++;
+    }
+    flushOutput();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+CommandPlan CommandController::compilePlan(std::string_view script,
+                                           std::vector<PlanError>& errors) const {
+    return CommandPlan::compile(script, *commandRegistry_, errors);
+}
+
+CheckResult CommandController::checkScript(std::string_view script) const {
+    return ScriptChecker(*commandRegistry_).check(script);
+}
+
+CommandController::LineStatus CommandController::processCommandLine(std::string_view commandLine) {
+    parser_.reset(commandLine);
+    ParsedCommand parsed = parser_.parseCommand();
+    const auto* metaCmd = parsed.isValid ? commandRegistry_->getMetaCommand(parsed.commandName)
+                                         : nullptr;
+    const auto* invoker = metaCmd ? commandRegistry_->getInvoker(parsed.commandName) : nullptr;
+    return dispatchCommand(parsed, metaCmd, invoker);
+}
+
+CommandController::LineStatus CommandController::dispatchCommand(const ParsedCommand& parsed,
+                                                                  const core::IMetaCommand* metaCmd,
+                                                                  const CommandInvoker* invoker) {
     if (!parsed.isValid) {
         view_->displayError(parsed.errorMessage);
-        return true;
+        return LineStatus::FAILED;
     }
     
-    const auto* metaCmd = commandRegistry_->getMetaCommand(parsed.commandName);
     if (!metaCmd) {
         view_->displayError("Unknown command: " + parsed.commandName);
+        return LineStatus::FAILED;
+    }
+    
+    return executeCommand(*metaCmd, invoker, parsed.arguments, parsed.commandName == "exit");
+}
+
+CommandController::LineStatus CommandController::executeCommand(const core::IMetaCommand& metaCmd,
+                                                                 const CommandInvoker* invoker,
+                                                                 core::ArgumentSpan arguments,
+                                                                 bool isExit) {
+    const bool success = invoker ? invokeTyped(*invoker, arguments)
+                                 : invokeCreator(metaCmd, arguments);
+    
+    // Unchanged slides are skipped, so this is cheap after non-mutating commands
+    if (previewServer_->isRunning()) {
+        previewServer_->publish(repository_.get());
+    }
+    
+    if (isExit) {
+        return LineStatus::EXIT;
+    }
+    if (!success) {
+        commandOutput_->flush();  // Errors are seen when they happen, like view errors
+        return LineStatus::FAILED;
+    }
+    
+    return LineStatus::SUCCEEDED;
+}
+
+bool CommandController::invokeTyped(const CommandInvoker& invoker, core::ArgumentSpan arguments) {
+    // Inside a transaction actions run silently; 'commit' reports them together
+    if (invoker.isAction() && commandHistory_->isGroupOpen()) {
+        std::string failure;
+        if (!invoker.invoke(arguments, context_, groupOutput_, *commandHistory_, &failure)) {
+            view_->displayError(failure);
+            return false;
+        }
         return true;
     }
     
-    auto creator = metaCmd->getCreator();
-    auto command = creator(parsed.arguments, &context_);
+    return invoker.invoke(arguments, context_, *commandOutput_, *commandHistory_);
+}
+
+bool CommandController::invokeCreator(const core::IMetaCommand& metaCmd,
+                                      core::ArgumentSpan arguments) {
+    auto command = metaCmd.getCreator()(arguments, &context_);
     if (!command) {
         view_->displayError("Failed to create command");
-        return true;
+        return false;
+    }
+    
+    // Same transaction handling as invokeTyped
+    const bool grouped = command->isAction() && commandHistory_->isGroupOpen();
+    bool success = command->execute(grouped ? groupOutput_ : *commandOutput_);
+    if (!success && grouped) {
+        view_->displayError(command->getResultMessage());
     }
     
-    auto output = std::make_shared<io::OutputStream>(std::cout);
-    bool success = command->execute(*output);
     if (success) {
         if (command->isAction()) {
             auto* undoableCmd = dynamic_cast<core::IUndoableCommand*>(command.get());
@@ -123,7 +512,7 @@ bool CommandController::processCommandLine(const std::string& commandLine) {
         }
     }
     
-    return parsed.commandName != "exit";
+    return success;
 }
 
 } // namespace slideEditor::controller
\ No newline at end of file
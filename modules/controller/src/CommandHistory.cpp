@@ -1,15 +1,26 @@
 #include "controller/CommandHistory.hpp"
+#include "controller/commands/UndoableCommands.hpp"
+#include "io/OutputStream.hpp"
 
 namespace slideEditor::controller {
 
 CommandHistory::CommandHistory(size_t maxSize) 
-    : maxHistorySize_(maxSize) {}
+    : maxHistorySize_(maxSize), groupOpen_(false) {}
 
 void CommandHistory::pushAction(std::unique_ptr<core::IUndoableCommand> action) {
     if (!action) {
         return;
     }
     
+    if (groupOpen_) {
+        group_.push_back(std::move(action));
+        return;
+    }
+    
+    pushEntry(std::move(action));
+}
+
+void CommandHistory::pushEntry(std::unique_ptr<core::IUndoableCommand> action) {
     redoStack_.clear(); // clear redo stack after action
     undoStack_.push_back(std::move(action));
     if (undoStack_.size() > maxHistorySize_) {
@@ -18,7 +29,7 @@ void CommandHistory::pushAction(std::unique_ptr<core::IUndoableCommand> action)
 }
 
 bool CommandHistory::undoLastAction() {
-    if (!canUndoAction()) {
+    if (groupOpen_ || !canUndoAction()) {
         return false;
     }
     
@@ -36,13 +47,15 @@ bool CommandHistory::undoLastAction() {
 }
 
 bool CommandHistory::redoLastAction() {
-    if (!canRedoAction()) {
+    if (groupOpen_ || !canRedoAction()) {
         return false;
     }
     
     auto action = std::move(redoStack_.back());
     redoStack_.pop_back();
-    bool success = action->execute();
+    io::OutputStream sink;  // Redo is reported by RedoCommand, not the action
+    sink.setVerbosity(core::Verbosity::QUIET);
+    bool success = action->execute(sink);
     if (success) {
         undoStack_.push_back(std::move(action));
     } 
@@ -80,6 +93,49 @@ std::string CommandHistory::getLastActionToRedo() const {
 void CommandHistory::clearHistory() {
     undoStack_.clear();
     redoStack_.clear();
+    group_.clear();
+    groupOpen_ = false;
+}
+
+bool CommandHistory::beginGroup() {
+    if (groupOpen_) {
+        return false;
+    }
+    
+    groupOpen_ = true;
+    return true;
+}
+
+size_t CommandHistory::commitGroup() {
+    groupOpen_ = false;
+    const size_t count = group_.size();
+    if (count > 0) {
+        pushEntry(std::make_unique<UndoableGroupCommand>(std::move(group_)));
+        group_.clear();
+    }
+    
+    return count;
+}
+
+size_t CommandHistory::rollbackGroup() {
+    groupOpen_ = false;
+    size_t undone = 0;
+    for (auto it = group_.rbegin(); it != group_.rend(); ++it) {
+        if ((*it)->undo()) {
+            ++undone;
+        }
+    }
+    
+    group_.clear();
+    return undone;
+}
+
+bool CommandHistory::isGroupOpen() const {
+    return groupOpen_;
+}
+
+size_t CommandHistory::getGroupSize() const {
+    return group_.size();
 }
 
 size_t CommandHistory::getUndoableActionCount() const {
@@ -0,0 +1,234 @@
+#include "controller/CommandPlan.hpp"
+#include "controller/CommandRegistry.hpp"
+#include "controller/parser/CommandParser.hpp"
+#include "controller/parser/KeywordTable.hpp"
+#include "io/SpanInputStream.hpp"
+#include <algorithm>
+#include <cctype>
+
+namespace slideEditor::controller {
+
+namespace {
+
+constexpr char MAGIC[6] = {'S', 'E', 'P', 'L', 'A', 'N'};
+constexpr uint16_t VERSION = 1;
+// Counts in the header are untrusted: containers grow as data actually arrives,
+// never sized from a count up front beyond these caps
+constexpr uint32_t RESERVE_CAP = 1 << 16;
+constexpr size_t STRING_CHUNK = 64 * 1024;
+
+enum ArgumentTag : uint8_t {
+    TAG_INT = 0,
+    TAG_DOUBLE = 1,
+    TAG_STRING = 2
+};
+
+template <typename T>
+void writeValue(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+// Reads length bytes in chunks, so a forged length fails at end of input
+// instead of allocating it first
+bool readString(std::istream& in, uint32_t length, std::string& text) {
+    text.clear();
+    size_t remaining = length;
+    while (remaining > 0) {
+        const size_t chunk = std::min(remaining, STRING_CHUNK);
+        const size_t offset = text.size();
+        text.resize(offset + chunk);
+        if (!in.read(text.data() + offset, static_cast<std::streamsize>(chunk))) {
+            return false;
+        }
+        remaining -= chunk;
+    }
+
+    return true;
+}
+
+bool isBlank(const std::string& line) {
+    return std::all_of(line.begin(), line.end(), [](unsigned char c) {
+        return std::isspace(c);
+    });
+}
+
+} // namespace
+
+CommandPlan CommandPlan::compile(std::string_view script, const CommandRegistry& registry,
+                                 std::vector<PlanError>& errors) {
+    CommandPlan plan;
+    io::SpanInputStream input(script);
+    CommandParser parser;
+    // The parser only reads metadata; it never changes the registry
+    parser.setRegistry(const_cast<CommandRegistry*>(&registry));
+
+    constexpr int EXIT_OPCODE = keywords::find("exit");
+    std::string line;
+    size_t lineNumber = 0;
+    while (input.readLine(line)) {
+        ++lineNumber;
+        if (isBlank(line)) {
+            continue;
+        }
+
+        parser.reset(line);
+        ParsedCommand parsed = parser.parseCommand();
+        if (!parsed.isValid) {
+            errors.push_back({lineNumber, parsed.errorMessage});
+            continue;
+        }
+
+        const int opcode = keywords::find(parsed.commandName);
+        if (opcode == keywords::kNotFound) {
+            errors.push_back({lineNumber, "Command cannot be compiled: " + parsed.commandName});
+            continue;
+        }
+
+        PlanOp op;
+        op.opcode = static_cast<uint8_t>(opcode);
+        op.argCount = static_cast<uint8_t>(parsed.arguments.size());
+        op.firstArg = static_cast<uint32_t>(plan.arguments_.size());
+        op.line = static_cast<uint32_t>(lineNumber);
+        plan.operations_.push_back(op);
+        for (auto& argument : parsed.arguments) {
+            plan.arguments_.push_back(std::move(argument));
+        }
+
+        if (opcode == EXIT_OPCODE) {
+            break;  // Nothing after 'exit' would run
+        }
+    }
+
+    return plan;
+}
+
+bool CommandPlan::save(std::ostream& out) const {
+    out.write(MAGIC, sizeof(MAGIC));
+    writeValue(out, VERSION);
+    writeValue(out, static_cast<uint32_t>(operations_.size()));
+    writeValue(out, static_cast<uint32_t>(arguments_.size()));
+    for (const auto& op : operations_) {
+        writeValue(out, op.opcode);
+        writeValue(out, op.argCount);
+        writeValue(out, op.firstArg);
+        writeValue(out, op.line);
+    }
+
+    for (const auto& argument : arguments_) {
+        if (const auto* value = std::get_if<int>(&argument.value)) {
+            writeValue(out, static_cast<uint8_t>(TAG_INT));
+            writeValue(out, static_cast<int32_t>(*value));
+        }
+        else if (const auto* value = std::get_if<double>(&argument.value)) {
+            writeValue(out, static_cast<uint8_t>(TAG_DOUBLE));
+            writeValue(out, *value);
+        }
+        else {
+            const auto& text = std::get<std::string>(argument.value);
+            writeValue(out, static_cast<uint8_t>(TAG_STRING));
+            writeValue(out, static_cast<uint32_t>(text.size()));
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+    }
+
+    return static_cast<bool>(out);
+}
+
+bool CommandPlan::load(std::istream& in) {
+    clear();
+    char magic[sizeof(MAGIC)];
+    uint16_t version = 0;
+    uint32_t operationCount = 0;
+    uint32_t argumentCount = 0;
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC) ||
+        !readValue(in, version) || version != VERSION ||
+        !readValue(in, operationCount) || !readValue(in, argumentCount)) {
+        return false;
+    }
+
+    std::vector<PlanOp> operations;
+    operations.reserve(std::min(operationCount, RESERVE_CAP));
+    for (uint32_t i = 0; i < operationCount; ++i) {
+        PlanOp op;
+        if (!readValue(in, op.opcode) || !readValue(in, op.argCount) ||
+            !readValue(in, op.firstArg) || !readValue(in, op.line)) {
+            return false;
+        }
+
+        if (op.opcode >= keywords::kCount ||
+            static_cast<uint64_t>(op.firstArg) + op.argCount > argumentCount) {
+            return false;
+        }
+        operations.push_back(op);
+    }
+
+    std::vector<core::CommandArgument> arguments;
+    arguments.reserve(std::min(argumentCount, RESERVE_CAP));
+    for (uint32_t i = 0; i < argumentCount; ++i) {
+        uint8_t tag = 0;
+        if (!readValue(in, tag)) {
+            return false;
+        }
+
+        if (tag == TAG_INT) {
+            int32_t value = 0;
+            if (!readValue(in, value)) {
+                return false;
+            }
+            arguments.emplace_back(static_cast<int>(value));
+        }
+        else if (tag == TAG_DOUBLE) {
+            double value = 0;
+            if (!readValue(in, value)) {
+                return false;
+            }
+            arguments.emplace_back(value);
+        }
+        else if (tag == TAG_STRING) {
+            uint32_t length = 0;
+            if (!readValue(in, length)) {
+                return false;
+            }
+            std::string text;
+            if (!readString(in, length, text)) {
+                return false;
+            }
+            arguments.emplace_back(std::move(text));
+        }
+        else {
+            return false;
+        }
+    }
+
+    operations_ = std::move(operations);
+    arguments_ = std::move(arguments);
+    return true;
+}
+
+const std::vector<PlanOp>& CommandPlan::getOperations() const {
+    return operations_;
+}
+
+core::ArgumentSpan CommandPlan::getArguments(const PlanOp& op) const {
+    return core::ArgumentSpan(arguments_.data() + op.firstArg, op.argCount);
+}
+
+size_t CommandPlan::size() const {
+    return operations_.size();
+}
+
+bool CommandPlan::empty() const {
+    return operations_.empty();
+}
+
+void CommandPlan::clear() {
+    operations_.clear();
+    arguments_.clear();
+}
+
+} // namespace slideEditor::controller
@@ -1,9 +1,34 @@
 #include "controller/CommandRegistry.hpp"
+#include "controller/MetaCommand.hpp"
 #include <algorithm>
 #include <sstream>
 
 namespace slideEditor::controller {
 
+bool CommandRegistry::CaseInsensitiveLess::operator()(std::string_view a,
+                                                      std::string_view b) const {
+    const size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; ++i) {
+        const char ca = keywords::fold(a[i]);
+        const char cb = keywords::fold(b[i]);
+        if (ca != cb) {
+            return static_cast<unsigned char>(ca) < static_cast<unsigned char>(cb);
+        }
+    }
+    
+    return a.size() < b.size();
+}
+
+namespace {
+
+// Only MetaCommand has a typed path; checked at registration, not per command
+const CommandInvoker* invokerOf(const core::IMetaCommand* metaCommand) {
+    const auto* typed = dynamic_cast<const MetaCommand*>(metaCommand);
+    return typed ? typed->getInvoker() : nullptr;
+}
+
+} // namespace
+
 void CommandRegistry::registerCommand(std::unique_ptr<core::IMetaCommand> metaCommand) {
     if (!metaCommand) {
         return;
@@ -13,15 +38,22 @@ void CommandRegistry::registerCommand(std::unique_ptr<core::IMetaCommand> metaCo
     std::transform(name.begin(), name.end(), name.begin(),
                    [](unsigned char c) { return std::tolower(c); });
     
-    commands_[name] = std::move(metaCommand);
+    const int keyword = keywords::find(name);
+    if (keyword != keywords::kNotFound) {
+        keywordSlots_[keyword] = metaCommand.get();
+        keywordInvokers_[keyword] = invokerOf(metaCommand.get());
+    }
+    
+    commands_.insert_or_assign(std::move(name), std::move(metaCommand));
 }
 
-const core::IMetaCommand* CommandRegistry::getMetaCommand(const std::string& name) const {
-    std::string lowerName = name;
-    std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
+const core::IMetaCommand* CommandRegistry::getMetaCommand(std::string_view name) const {
+    const int keyword = keywords::find(name);
+    if (keyword != keywords::kNotFound) {
+        return keywordSlots_[keyword];
+    }
     
-    auto it = commands_.find(lowerName);
+    auto it = commands_.find(name);
     if (it != commands_.end()) {
         return it->second.get();
     }
@@ -29,17 +61,18 @@ const core::IMetaCommand* CommandRegistry::getMetaCommand(const std::string& nam
     return nullptr;
 }
 
-core::IMetaCommand* CommandRegistry::getMetaCommand(const std::string& name) {
-    std::string lowerName = name;
-    std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-    
-    auto it = commands_.find(lowerName);
-    if (it != commands_.end()) {
-        return it->second.get();
+const CommandInvoker* CommandRegistry::getInvoker(std::string_view name) const {
+    const int keyword = keywords::find(name);
+    if (keyword != keywords::kNotFound) {
+        return keywordInvokers_[keyword];
     }
     
-    return nullptr;
+    return invokerOf(getMetaCommand(name));
+}
+
+core::IMetaCommand* CommandRegistry::getMetaCommand(std::string_view name) {
+    const auto* self = this;
+    return const_cast<core::IMetaCommand*>(self->getMetaCommand(name));
 }
 
 bool CommandRegistry::hasCommand(const std::string& name) const {
@@ -1,4 +1,5 @@
 #include "controller/InputHandler.hpp"
+#include <algorithm>
 #include <cctype>
 
 namespace slideEditor::controller {
@@ -13,57 +14,43 @@ InputHandler::InputHandler(core::IInputStream* input)
 }
 
 std::optional<std::string> InputHandler::readCommandLine() {
-    if (!input_ || eofReached_) {
+    std::string line;
+    if (!readCommandLine(line)) {
         return std::nullopt;
     }
     
-    std::string line;
-    bool foundContent = false;   
-    while (!input_->eof()) {
-        auto maybeChar = input_->get();
-        if (!maybeChar.has_value()) {
-            // EOF reached
+    return line;
+}
+
+bool InputHandler::readCommandLine(std::string& line) {
+    if (!input_ || eofReached_) {
+        return false;
+    }
+    
+    // Blank lines are skipped in a loop, so no input can run the stack out
+    while (input_->readLine(line)) {
+        // A line cut off by the end of input did not move to a new line
+        if (input_->eof()) {
             eofReached_ = true;
-            break;
+        } 
+        else {
+            lineNumber_++;
         }
         
-        char c = maybeChar.value();
-        if (c == '\n' || c == '\r') {
-            if (c == '\r') {
-                auto next = input_->peek();
-                if (next.has_value() && next.value() == '\n') {
-                    input_->get();  // Consume the \n
-                }
-            }
-            
-            lineNumber_++;
-            if (foundContent) {
-                break;
-            }
-
-            continue;
+        const bool foundContent = std::any_of(line.begin(), line.end(), [](unsigned char c) {
+            return !std::isspace(c);
+        });
+        if (foundContent) {
+            return true;
         }
         
-        line += c;
-        // Mark that we found non-whitespace content
-        if (!std::isspace(static_cast<unsigned char>(c))) {
-            foundContent = true;
+        if (eofReached_) {
+            return false;
         }
     }
     
-    if (foundContent && !line.empty()) {
-        return line;
-    }
-    
-    if (eofReached_ && !foundContent) {
-        return std::nullopt;
-    }
-    
-    if (line.empty() && !eofReached_) {
-        return readCommandLine();  // Recursive call for next line
-    }
-    
-    return foundContent ? std::optional<std::string>(line) : std::nullopt;
+    eofReached_ = true;
+    return false;
 }
 
 std::optional<char> InputHandler::readChar() {
@@ -30,6 +30,10 @@ core::CommandCreator MetaCommand::getCreator() const {
     return creator_;
 }
 
+const CommandInvoker* MetaCommand::getInvoker() const {
+    return invoker_.get();
+}
+
 const std::vector<core::ArgumentInfo>& MetaCommand::getArgumentInfo() const {
     return arguments_;
 }
@@ -66,6 +70,30 @@ bool MetaCommand::validateArguments(const std::vector<std::string>& args) const
     return true;
 }
 
+bool MetaCommand::validateParsedArguments(core::ArgumentSpan args) const {
+    if (args.size() < getRequiredArgCount() || args.size() > getMaxArgCount()) {
+        return false;
+    }
+    
+    // The parser converted by declared type; only check that it did
+    for (size_t i = 0; i < args.size(); ++i) {
+        const auto& type = arguments_[i].type;
+        const auto& value = args[i].value;
+        if (type == "int" && !std::holds_alternative<int>(value)) {
+            return false;
+        }
+        if (type == "double" && std::holds_alternative<std::string>(value)) {
+            return false;
+        }
+        if ((type == "string" || type == "identifier") && 
+            std::get_if<std::string>(&value) && std::get<std::string>(value).empty()) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
 std::string MetaCommand::getUsage() const {
     std::ostringstream oss;
     oss << name_;
@@ -0,0 +1,117 @@
+#include "controller/ScriptChecker.hpp"
+#include "controller/CommandRegistry.hpp"
+#include "controller/parser/CommandParser.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace slideEditor::controller {
+
+namespace {
+
+constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
+constexpr size_t CHUNKS_PER_WORKER = 8;  // Slack for uneven lines
+
+bool isBlank(std::string_view line) {
+    return std::all_of(line.begin(), line.end(), [](char c) {
+        return c == ' ' || c == '\t' || c == '\v' || c == '\f';
+    });
+}
+
+} // namespace
+
+ScriptChecker::ScriptChecker(const CommandRegistry& registry)
+    : registry_(registry) {}
+
+std::vector<std::string_view> ScriptChecker::splitChunks(std::string_view script,
+                                                         size_t chunkSize) {
+    std::vector<std::string_view> chunks;
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    size_t start = 0;
+    while (start < script.size()) {
+        size_t end = script.size();
+        if (script.size() - start > chunkSize) {
+            const char* from = script.data() + start + chunkSize - 1;
+            const auto* newline = static_cast<const char*>(
+                std::memchr(from, '\n', script.size() - (start + chunkSize - 1)));
+            if (newline) {
+                end = static_cast<size_t>(newline - script.data()) + 1;
+            }
+        }
+
+        chunks.push_back(script.substr(start, end - start));
+        start = end;
+    }
+
+    return chunks;
+}
+
+CheckResult ScriptChecker::check(std::string_view script, view::WorkStealingPool* pool,
+                                 size_t chunkSize) const {
+    view::WorkStealingPool& workers = pool ? *pool : view::WorkStealingPool::shared();
+    if (chunkSize == 0) {
+        const size_t pieces = (workers.getThreadCount() + 1) * CHUNKS_PER_WORKER;
+        chunkSize = std::max(MIN_CHUNK_SIZE, script.size() / pieces + 1);
+    }
+
+    const auto chunks = splitChunks(script, chunkSize);
+    std::vector<CheckResult> results(chunks.size());
+    workers.parallelFor(chunks.size(), [&](size_t i) {
+        results[i] = checkChunk(chunks[i]);
+    });
+
+    // Chunks end at newlines, so their line counts add up to script lines
+    CheckResult total;
+    for (auto& result : results) {
+        for (auto& error : result.errors) {
+            error.line += total.lines;
+            total.errors.push_back(std::move(error));
+        }
+        total.lines += result.lines;
+        total.commands += result.commands;
+    }
+
+    return total;
+}
+
+CheckResult ScriptChecker::checkChunk(std::string_view chunk) const {
+    CheckResult result;
+    CommandParser parser;
+    // The parser only reads metadata; it never changes the registry
+    parser.setRegistry(const_cast<CommandRegistry*>(&registry_));
+
+    // Same line breaks as IInputStream::readLine: "\n", "\r\n" or a lone "\r"
+    size_t position = 0;
+    while (position < chunk.size()) {
+        const char* begin = chunk.data() + position;
+        const size_t length = chunk.size() - position;
+        const auto* newline = static_cast<const char*>(std::memchr(begin, '\n', length));
+        size_t scan = newline ? static_cast<size_t>(newline - begin) : length;
+        size_t next = newline ? position + scan + 1 : chunk.size();
+        const auto* carriage = static_cast<const char*>(std::memchr(begin, '\r', scan));
+        if (carriage) {
+            scan = static_cast<size_t>(carriage - begin);
+            next = position + scan + 1;
+            if (next < chunk.size() && chunk[next] == '\n') {
+                ++next;
+            }
+        }
+
+        const std::string_view line = chunk.substr(position, scan);
+        position = next;
+        result.lines++;
+        if (isBlank(line)) {
+            continue;
+        }
+
+        result.commands++;
+        parser.reset(line);
+        ParsedCommand parsed = parser.parseCommand();
+        if (!parsed.isValid) {
+            result.errors.push_back({result.lines, parsed.errorMessage});
+        }
+    }
+
+    return result;
+}
+
+} // namespace slideEditor::controller
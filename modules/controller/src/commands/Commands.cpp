@@ -1,23 +1,25 @@
 #include "controller/commands/Commands.hpp"
 #include "controller/CommandRegistry.hpp" 
+#include "controller/commands/ResultOutput.hpp"
 #include "view/SvgGenerator.hpp"      
 #include "view/BrowserOpener.hpp"
-#include "../../model/SlideFactory.hpp"
+#include "view/raster/RasterRenderer.hpp"
 #include <sstream>
+#include <algorithm>
 
 namespace slideEditor::controller {
 
 SaveCommand::SaveCommand(std::shared_ptr<core::ISlideRepository> repo,
                          std::shared_ptr<core::ISerializer> serializer,
                          std::string filename)
-    : repository_(repo), serializer_(serializer),
-      filename_(std::move(filename)), success_(false) {}
+    : repository_(std::move(repo)), serializer_(std::move(serializer)),
+      filename_(std::move(filename)), result_(Result::NONE), success_(false) {}
 
 bool SaveCommand::execute(core::IOutputStream& output) {
     if (!repository_ || !serializer_) {
         success_ = false;
-        message_ = "Error: Required components not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
 
         return false;
     }
@@ -25,20 +27,32 @@ bool SaveCommand::execute(core::IOutputStream& output) {
     bool saved = serializer_->save(repository_.get(), filename_);
     if (saved) {
         success_ = true;
-        message_ = "Presentation saved to '" + filename_ + "'";
-        output.writeLine(message_);
+        result_ = Result::SAVED;
+        writeResult(*this, output);
         return true;
     }
     
     success_ = false;
-    message_ = "Error: " + serializer_->getLastError();
-    output.writeLine("[ERROR] " + message_);
+    result_ = Result::SAVE_FAILED;
+    error_ = serializer_->getLastError();
+    writeResult(*this, output);
 
     return false;
 }
 
 std::string SaveCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::SAVED:
+            return "Presentation saved to '" + filename_ + "'";
+        case Result::SAVE_FAILED:
+            return "Error: " + error_;
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool SaveCommand::wasSuccessful() const {
@@ -50,14 +64,14 @@ bool SaveCommand::wasSuccessful() const {
 LoadCommand::LoadCommand(std::shared_ptr<core::ISlideRepository> repo,
                          std::shared_ptr<core::ISerializer> serializer,
                          std::string filename)
-    : repository_(repo), serializer_(serializer),
-      filename_(std::move(filename)), success_(false) {}
+    : repository_(std::move(repo)), serializer_(std::move(serializer)),
+      filename_(std::move(filename)), result_(Result::NONE), success_(false) {}
 
 bool LoadCommand::execute(core::IOutputStream& output) {
     if (!repository_ || !serializer_) {
         success_ = false;
-        message_ = "Error: Required components not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
 
         return false;
     }
@@ -65,21 +79,33 @@ bool LoadCommand::execute(core::IOutputStream& output) {
     bool loaded = serializer_->load(repository_.get(), filename_);
     if (loaded) {
         success_ = true;
-        message_ = "Presentation loaded from '" + filename_ + "'";
-        output.writeLine(message_);
+        result_ = Result::LOADED;
+        writeResult(*this, output);
 
         return true;
     }
     
     success_ = false;
-    message_ = "Error: " + serializer_->getLastError();
-    output.writeLine("[ERROR] " + message_);
+    result_ = Result::LOAD_FAILED;
+    error_ = serializer_->getLastError();
+    writeResult(*this, output);
 
     return false;
 }
 
 std::string LoadCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::LOADED:
+            return "Presentation loaded from '" + filename_ + "'";
+        case Result::LOAD_FAILED:
+            return "Error: " + error_;
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool LoadCommand::wasSuccessful() const {
@@ -90,25 +116,35 @@ bool LoadCommand::wasSuccessful() const {
 
 DisplayCommand::DisplayCommand(std::shared_ptr<core::ISlideRepository> repo,
                                std::shared_ptr<core::IView> view)
-    : repository_(repo), view_(view), success_(false) {}
+    : repository_(std::move(repo)), view_(std::move(view)), result_(Result::NONE),
+      success_(false) {}
 
 bool DisplayCommand::execute(core::IOutputStream& output) {
     std::ignore = output;  // Display uses view directly
     if (!repository_ || !view_) {
         success_ = false;
-        message_ = "Error: Required components not available";
+        result_ = Result::NO_COMPONENTS;
         return false;
     }
     
     view_->displaySlides(repository_.get());
     success_ = true;
-    message_ = "Slides displayed";
+    result_ = Result::DISPLAYED;
 
     return true;
 }
 
 std::string DisplayCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::DISPLAYED:
+            return "Slides displayed";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool DisplayCommand::wasSuccessful() const {
@@ -120,15 +156,16 @@ bool DisplayCommand::wasSuccessful() const {
 HelpCommand::HelpCommand(CommandRegistry* registry,
                          std::shared_ptr<core::IView> view,
                          std::string specificCommand)
-    : registry_(registry), view_(view),
+    : registry_(registry), view_(std::move(view)),
       specificCommand_(std::move(specificCommand)),
+      result_(Result::NONE),
       success_(false) {}
 
 bool HelpCommand::execute(core::IOutputStream& output) {
     std::ignore = output;  // Help uses view directly
     if (!registry_ || !view_) {
         success_ = false;
-        message_ = "Error: Required components not available";
+        result_ = Result::NO_COMPONENTS;
         return false;
     }
     
@@ -136,17 +173,17 @@ bool HelpCommand::execute(core::IOutputStream& output) {
         // Show all commands
         std::string helpText = registry_->getAllCommandsHelp();
         view_->displayHelp(helpText);
-        message_ = "Help displayed";
+        result_ = Result::ALL_SHOWN;
     } 
     else {
         if (registry_->hasCommand(specificCommand_)) {
             std::string helpText = registry_->getCommandHelp(specificCommand_);
             view_->displayHelp(helpText);
-            message_ = "Help for '" + specificCommand_ + "' displayed";
+            result_ = Result::COMMAND_SHOWN;
         } 
         else {
             view_->displayError("Unknown command: " + specificCommand_);
-            message_ = "Error: Unknown command";
+            result_ = Result::UNKNOWN_COMMAND;
         }
     }
     
@@ -155,7 +192,20 @@ bool HelpCommand::execute(core::IOutputStream& output) {
 }
 
 std::string HelpCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::ALL_SHOWN:
+            return "Help displayed";
+        case Result::COMMAND_SHOWN:
+            return "Help for '" + specificCommand_ + "' displayed";
+        case Result::UNKNOWN_COMMAND:
+            return "Error: Unknown command";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool HelpCommand::wasSuccessful() const {
@@ -164,18 +214,18 @@ bool HelpCommand::wasSuccessful() const {
 
 // ===== ExitCommand =====
 
-ExitCommand::ExitCommand() : success_(false) {}
+ExitCommand::ExitCommand() : result_(Result::NONE), success_(false) {}
 
 bool ExitCommand::execute(core::IOutputStream& output) {
     success_ = true;
-    message_ = "Exiting...";
-    output.writeLine(message_);
+    result_ = Result::EXITING;
+    writeResult(*this, output);
     
     return true;
 }
 
 std::string ExitCommand::getResultMessage() const {
-    return message_;
+    return result_ == Result::EXITING ? "Exiting..." : "";
 }
 
 bool ExitCommand::wasSuccessful() const {
@@ -185,9 +235,17 @@ bool ExitCommand::wasSuccessful() const {
 // ===== DrawCommand =====
 DrawCommand::DrawCommand(std::shared_ptr<core::ISlideRepository> repo,
                          std::shared_ptr<core::IView> view,
-                         std::string filename)
-    : repository_(repo), view_(view),
-      filename_(std::move(filename)), success_(false) {
+                         std::string filename,
+                         std::shared_ptr<view::SvgFragmentCache> cache,
+                         view::SvgOptions options,
+                         int fromSlide, int toSlide,
+                         std::shared_ptr<view::SvgRenderer> renderer,
+                         bool openBrowser)
+    : repository_(std::move(repo)), view_(std::move(view)),
+      filename_(std::move(filename)), cache_(std::move(cache)),
+      options_(options), fromSlide_(fromSlide), toSlide_(toSlide), 
+      renderer_(std::move(renderer)), openBrowser_(openBrowser), result_(Result::NONE),
+      slideCount_(0), success_(false) {
     // Ensure .svg extension
     if (filename_.find(".svg") == std::string::npos) {
         filename_ += ".svg";
@@ -197,46 +255,424 @@ DrawCommand::DrawCommand(std::shared_ptr<core::ISlideRepository> repo,
 bool DrawCommand::execute(core::IOutputStream& output) {
     if (!repository_ || !view_) {
         success_ = false;
-        message_ = "Error: Required components not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
 
         return false;
     }
     
-    view::SvgGenerator generator;
-    bool saved = generator.generateAndSave(repository_.get(), filename_);
+    size_t first = 0;
+    size_t last = repository_->getSlideCount();
+    if (fromSlide_ != 0 || toSlide_ != 0) {
+        if (fromSlide_ < 1 || toSlide_ < fromSlide_ || 
+            static_cast<size_t>(toSlide_) > repository_->getSlideCount()) {
+            success_ = false;
+            result_ = Result::INVALID_RANGE;
+            slideCount_ = repository_->getSlideCount();
+            writeResult(*this, output);
+
+            return false;
+        }
+
+        first = static_cast<size_t>(fromSlide_ - 1);
+        last = static_cast<size_t>(toSlide_);
+    }
+    
+    bool saved = renderer_ 
+        ? renderer_->renderToFile(repository_.get(), filename_, first, last, cache_.get(), options_)
+        : view::SvgGenerator::generateAndSaveRange(repository_.get(), filename_,
+                                                   first, last, cache_.get(), options_);
     if (!saved) {
         success_ = false;
-        message_ = "Error: Failed to generate SVG file";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::GENERATE_FAILED;
+        writeResult(*this, output);
 
         return false;
     }
     
-    output.writeLine("SVG file generated: " + filename_);
+    if (!openBrowser_) {
+        success_ = true;
+        result_ = Result::GENERATED;
+        writeResult(*this, output);
+
+        return true;
+    }
+    
     bool opened = view::BrowserOpener::openInBrowser(filename_);
     if (opened) {
         success_ = true;
-        message_ = "SVG generated and opened in browser: " + filename_;
-        output.writeLine(message_);
+        result_ = Result::OPENED;
+        writeResult(*this, output);
 
         return true;
     } 
     else {
         success_ = true;  // File was created successfully
-        message_ = "SVG generated: " + filename_ + " (failed to open browser automatically)";
-        output.writeLine(message_);
+        result_ = Result::OPEN_FAILED;
+        writeResult(*this, output);
 
         return true;
     }
 }
 
 std::string DrawCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::INVALID_RANGE:
+            return "Error: Invalid slide range " + std::to_string(fromSlide_) + "-" +
+                   std::to_string(toSlide_) + " (deck has " + 
+                   std::to_string(slideCount_) + " slides)";
+        case Result::GENERATE_FAILED:
+            return "Error: Failed to generate SVG file";
+        case Result::GENERATED:
+            return "SVG file generated: " + filename_ + "\nSVG generated: " + filename_ +
+                   " (live preview is running)";
+        case Result::OPENED:
+            return "SVG file generated: " + filename_ + "\nSVG generated and opened in browser: " +
+                   filename_;
+        case Result::OPEN_FAILED:
+            return "SVG file generated: " + filename_ + "\nSVG generated: " + filename_ +
+                   " (failed to open browser automatically)";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool DrawCommand::wasSuccessful() const {
     return success_;
 }
 
+// ===== DrawPagesCommand =====
+DrawPagesCommand::DrawPagesCommand(std::shared_ptr<core::ISlideRepository> repo,
+                                   std::string basename, int pageSize,
+                                   std::shared_ptr<view::SvgFragmentCache> cache,
+                                   view::SvgOptions options,
+                                   std::shared_ptr<view::SvgRenderer> renderer)
+    : repository_(std::move(repo)), basename_(std::move(basename)), pageSize_(pageSize),
+      cache_(std::move(cache)), options_(options), renderer_(std::move(renderer)), 
+      result_(Result::NONE), pageCount_(0), success_(false) {
+    // Page numbers go before the extension
+    size_t ext = basename_.rfind(".svg");
+    if (ext != std::string::npos && ext + 4 == basename_.size()) {
+        basename_.erase(ext);
+    }
+}
+
+bool DrawPagesCommand::execute(core::IOutputStream& output) {
+    if (!repository_) {
+        success_ = false;
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    if (pageSize_ < 1) {
+        success_ = false;
+        result_ = Result::INVALID_PAGE_SIZE;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    size_t slideCount = repository_->getSlideCount();
+    size_t pageSize = static_cast<size_t>(pageSize_);
+    size_t pageCount = (slideCount + pageSize - 1) / pageSize;
+    view::SvgRenderer localRenderer;
+    view::SvgRenderer& renderer = renderer_ ? *renderer_ : localRenderer;  // One buffer for all pages
+    for (size_t page = 0; page < pageCount; ++page) {
+        size_t first = page * pageSize;
+        size_t last = std::min(first + pageSize, slideCount);
+        std::string filename = pageFilename(basename_, page + 1);
+        if (!renderer.renderToFile(repository_.get(), filename, first, last, cache_.get(), options_)) {
+            success_ = false;
+            result_ = Result::PAGE_FAILED;
+            pageCount_ = page + 1;
+            writeResult(*this, output);
+
+            return false;
+        }
+    }
+    
+    success_ = true;
+    result_ = Result::GENERATED;
+    pageCount_ = pageCount;
+    writeResult(*this, output);
+
+    return true;
+}
+
+std::string DrawPagesCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::INVALID_PAGE_SIZE:
+            return "Error: Page size must be at least 1";
+        case Result::PAGE_FAILED:
+            return "Error: Failed to generate SVG file " + pageFilename(basename_, pageCount_);
+        case Result::GENERATED:
+            return "SVG pages generated: " + std::to_string(pageCount_) + " file(s) as " + 
+                   basename_ + "-N.svg";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool DrawPagesCommand::wasSuccessful() const {
+    return success_;
+}
+
+std::string DrawPagesCommand::pageFilename(const std::string& basename, size_t page) {
+    return basename + "-" + std::to_string(page) + ".svg";
+}
+
+// ===== DrawSplitCommand =====
+DrawSplitCommand::DrawSplitCommand(std::shared_ptr<core::ISlideRepository> repo,
+                                   std::shared_ptr<view::SplitExporter> exporter,
+                                   std::string directory, view::SvgOptions options)
+    : repository_(std::move(repo)), exporter_(std::move(exporter)), directory_(std::move(directory)),
+      options_(options), result_(Result::NONE), success_(false) {}
+
+bool DrawSplitCommand::execute(core::IOutputStream& output) {
+    if (!repository_ || !exporter_) {
+        success_ = false;
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    if (!exporter_->exportSlides(repository_.get(), directory_, options_, stats_)) {
+        success_ = false;
+        result_ = Result::EXPORT_FAILED;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    success_ = true;
+    result_ = Result::EXPORTED;
+    writeResult(*this, output);
+
+    return true;
+}
+
+std::string DrawSplitCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::EXPORT_FAILED:
+            return "Error: Failed to export slides to " + directory_;
+        case Result::EXPORTED:
+            return "Slides exported to " + directory_ + "/: " + 
+                   std::to_string(stats_.written) + " written, " + 
+                   std::to_string(stats_.unchanged) + " unchanged, " + 
+                   std::to_string(stats_.removed) + " removed";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool DrawSplitCommand::wasSuccessful() const {
+    return success_;
+}
+
+// ===== ExportCommand =====
+ExportCommand::ExportCommand(std::shared_ptr<core::ISlideRepository> repo,
+                             std::string filename, view::ImageFormat format,
+                             int fromSlide, int toSlide, view::LayoutMode layout)
+    : repository_(std::move(repo)), filename_(std::move(filename)), format_(format),
+      fromSlide_(fromSlide), toSlide_(toSlide), layout_(layout), result_(Result::NONE), slideCount_(0),
+      success_(false) {
+    // Ensure the extension matches the format
+    std::string extension = view::ImageWriter::extension(format_);
+    if (filename_.size() < extension.size() || 
+        filename_.compare(filename_.size() - extension.size(), extension.size(), extension) != 0) {
+        filename_ += extension;
+    }
+}
+
+bool ExportCommand::execute(core::IOutputStream& output) {
+    if (!repository_) {
+        success_ = false;
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    size_t first = 0;
+    size_t last = repository_->getSlideCount();
+    if (fromSlide_ != 0 || toSlide_ != 0) {
+        if (fromSlide_ < 1 || toSlide_ < fromSlide_ || 
+            static_cast<size_t>(toSlide_) > repository_->getSlideCount()) {
+            success_ = false;
+            result_ = Result::INVALID_RANGE;
+            slideCount_ = repository_->getSlideCount();
+            writeResult(*this, output);
+
+            return false;
+        }
+
+        first = static_cast<size_t>(fromSlide_ - 1);
+        last = static_cast<size_t>(toSlide_);
+    }
+    
+    if (!view::RasterRenderer::renderToFile(repository_.get(), filename_, format_, first, last,
+                                            layout_)) {
+        success_ = false;
+        result_ = Result::WRITE_FAILED;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    success_ = true;
+    result_ = Result::GENERATED;
+    writeResult(*this, output);
+
+    return true;
+}
+
+std::string ExportCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::INVALID_RANGE:
+            return "Error: Invalid slide range " + std::to_string(fromSlide_) + "-" +
+                   std::to_string(toSlide_) + " (deck has " + 
+                   std::to_string(slideCount_) + " slides)";
+        case Result::WRITE_FAILED:
+            return "Error: Failed to write image file " + filename_;
+        case Result::GENERATED:
+            return "Image file generated: " + filename_;
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool ExportCommand::wasSuccessful() const {
+    return success_;
+}
+
+// ===== PreviewCommand =====
+PreviewCommand::PreviewCommand(std::shared_ptr<core::ISlideRepository> repo,
+                               std::shared_ptr<view::PreviewServer> server, int port)
+    : repository_(std::move(repo)), server_(std::move(server)), port_(port),
+      result_(Result::NONE), success_(false) {}
+
+bool PreviewCommand::execute(core::IOutputStream& output) {
+    if (!repository_ || !server_) {
+        success_ = false;
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    if (port_ < 0 || port_ > 65535) {
+        success_ = false;
+        result_ = Result::INVALID_PORT;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    if (!server_->isRunning() && !server_->start(port_)) {
+        success_ = false;
+        result_ = Result::START_FAILED;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    server_->publish(repository_.get());
+    success_ = true;
+    result_ = Result::STARTED;
+    writeResult(*this, output);
+
+    return true;
+}
+
+std::string PreviewCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::INVALID_PORT:
+            return "Error: Invalid port " + std::to_string(port_);
+        case Result::START_FAILED:
+            return "Error: Could not start preview server on port " + std::to_string(port_);
+        case Result::STARTED:
+            return "Live preview at " + server_->getUrl() + " (updates after every command)";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool PreviewCommand::wasSuccessful() const {
+    return success_;
+}
+
+// ===== SvgModeCommand =====
+
+SvgModeCommand::SvgModeCommand(std::shared_ptr<view::SvgOptions> options, std::string mode)
+    : options_(std::move(options)), mode_(std::move(mode)), result_(Result::NONE),
+      success_(false) {}
+
+bool SvgModeCommand::execute(core::IOutputStream& output) {
+    if (!options_) {
+        success_ = false;
+        result_ = Result::NO_COMPONENTS;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    view::SvgOptions updated = *options_;
+    if (!view::SvgGenerator::parseMode(mode_, updated)) {
+        success_ = false;
+        result_ = Result::UNKNOWN_MODE;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    *options_ = updated;
+    success_ = true;
+    result_ = Result::MODE_SET;
+    writeResult(*this, output);
+
+    return true;
+}
+
+std::string SvgModeCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NO_COMPONENTS:
+            return "Error: Required components not available";
+        case Result::UNKNOWN_MODE:
+            return "Error: Unknown SVG mode '" + mode_ + "' (expected plain, defs, classes, compact, grid or packed)";
+        case Result::MODE_SET:
+            return "SVG output mode set to " + mode_;
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool SvgModeCommand::wasSuccessful() const {
+    return success_;
+}
+
 } // namespace slideEditor::controller
\ No newline at end of file
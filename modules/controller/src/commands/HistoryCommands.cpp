@@ -1,4 +1,5 @@
 #include "controller/commands/HistoryCommands.hpp"
+#include "controller/commands/ResultOutput.hpp"
 
 namespace slideEditor::controller {
 
@@ -8,44 +9,68 @@ namespace slideEditor::controller {
 
 UndoCommand::UndoCommand(std::shared_ptr<CommandHistory> history, 
                          std::shared_ptr<core::IView> view)
-    : history_(history), view_(view), success_(false) {}
+    : history_(std::move(history)), view_(std::move(view)), result_(Result::NONE),
+      success_(false) {}
 
 bool UndoCommand::execute(core::IOutputStream& output) {
     if (!history_) {
         success_ = false;
-        message_ = "Error: Command history not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_HISTORY;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    if (history_->isGroupOpen()) {
+        success_ = false;
+        result_ = Result::GROUP_OPEN;
+        writeResult(*this, output);
 
         return false;
     }
     
     if (!history_->canUndoAction()) {
         success_ = false;
-        message_ = "Nothing to undo";
-        output.writeLine(message_);
+        result_ = Result::NOTHING_TO_UNDO;
+        output.writeLine(getResultMessage());  // Not worth an [ERROR] prefix
 
         return false;
     }
     
-    std::string actionDescription = history_->getLastActionToUndo();
+    description_ = history_->getLastActionToUndo();
     bool undone = history_->undoLastAction();
     if (undone) {
         success_ = true;
-        message_ = "[UNDO] Undone action: " + actionDescription;
-        output.writeLine(message_);
+        result_ = Result::UNDONE;
+        writeResult(*this, output);
 
         return true;
     }
     
     success_ = false;
-    message_ = "Error: Failed to undo action";
-    output.writeLine("[ERROR] " + message_);
+    result_ = Result::UNDO_FAILED;
+    writeResult(*this, output);
 
     return false;
 }
 
 std::string UndoCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_HISTORY:
+            return "Error: Command history not available";
+        case Result::GROUP_OPEN:
+            return "Error: Commit or roll back the open transaction before undo";
+        case Result::NOTHING_TO_UNDO:
+            return "Nothing to undo";
+        case Result::UNDONE:
+            return "[UNDO] Undone action: " + description_;
+        case Result::UNDO_FAILED:
+            return "Error: Failed to undo action";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool UndoCommand::wasSuccessful() const {
@@ -59,49 +84,210 @@ bool UndoCommand::wasSuccessful() const {
 
 RedoCommand::RedoCommand(std::shared_ptr<CommandHistory> history, 
                          std::shared_ptr<core::IView> view)
-    : history_(history), view_(view), success_(false) {}
+    : history_(std::move(history)), view_(std::move(view)), success_(false),
+      result_(Result::NONE) {}
 
 bool RedoCommand::execute(core::IOutputStream& output) {
     if (!history_) {
         success_ = false;
-        message_ = "Error: Command history not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_HISTORY;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    if (history_->isGroupOpen()) {
+        success_ = false;
+        result_ = Result::GROUP_OPEN;
+        writeResult(*this, output);
 
         return false;
     }
     
     if (!history_->canRedoAction()) {
         success_ = false;
-        message_ = "Nothing to redo";
-        output.writeLine(message_);
+        result_ = Result::NOTHING_TO_REDO;
+        output.writeLine(getResultMessage());  // Not worth an [ERROR] prefix
 
         return false;
     }
     
-    std::string actionDescription = history_->getLastActionToRedo();
+    description_ = history_->getLastActionToRedo();
     bool redone = history_->redoLastAction();
     if (redone) {
         success_ = true;
-        message_ = "[REDO] Redone action: " + actionDescription;
-        output.writeLine(message_);
+        result_ = Result::REDONE;
+        writeResult(*this, output);
 
         return true;
     }
     
     success_ = false;
-    message_ = "Error: Failed to redo action";
-    output.writeLine("[ERROR] " + message_);
+    result_ = Result::REDO_FAILED;
+    writeResult(*this, output);
 
     return false;
 }
 
 
 std::string RedoCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_HISTORY:
+            return "Error: Command history not available";
+        case Result::GROUP_OPEN:
+            return "Error: Commit or roll back the open transaction before redo";
+        case Result::NOTHING_TO_REDO:
+            return "Nothing to redo";
+        case Result::REDONE:
+            return "[REDO] Redone action: " + description_;
+        case Result::REDO_FAILED:
+            return "Error: Failed to redo action";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool RedoCommand::wasSuccessful() const {
     return success_;
 }
 
-} // namespace slideEditor::controller
\ No newline at end of file
+// ========================================
+// BeginCommand (META-COMMAND)
+// ========================================
+
+BeginCommand::BeginCommand(std::shared_ptr<CommandHistory> history)
+    : history_(std::move(history)), success_(false), result_(Result::NONE) {}
+
+bool BeginCommand::execute(core::IOutputStream& output) {
+    if (!history_) {
+        success_ = false;
+        result_ = Result::NO_HISTORY;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    if (!history_->beginGroup()) {
+        success_ = false;
+        result_ = Result::ALREADY_OPEN;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    success_ = true;
+    result_ = Result::STARTED;
+    writeResult(*this, output);
+
+    return true;
+}
+
+std::string BeginCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NO_HISTORY:
+            return "Error: Command history not available";
+        case Result::ALREADY_OPEN:
+            return "Error: A transaction is already open";
+        case Result::STARTED:
+            return "[TRANSACTION] Started; actions are applied silently until commit";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool BeginCommand::wasSuccessful() const {
+    return success_;
+}
+
+// ========================================
+// CommitCommand (META-COMMAND)
+// ========================================
+
+CommitCommand::CommitCommand(std::shared_ptr<CommandHistory> history)
+    : history_(std::move(history)), success_(false), result_(Result::NONE), count_(0) {}
+
+bool CommitCommand::execute(core::IOutputStream& output) {
+    if (!history_ || !history_->isGroupOpen()) {
+        success_ = false;
+        result_ = Result::NOT_OPEN;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    count_ = history_->commitGroup();
+    success_ = true;
+    result_ = Result::COMMITTED;
+    writeResult(*this, output);
+
+    return true;
+}
+
+std::string CommitCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NOT_OPEN:
+            return "Error: No open transaction";
+        case Result::COMMITTED:
+            return "[TRANSACTION] Committed " + std::to_string(count_) + " actions as one undo step";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool CommitCommand::wasSuccessful() const {
+    return success_;
+}
+
+// ========================================
+// RollbackCommand (META-COMMAND)
+// ========================================
+
+RollbackCommand::RollbackCommand(std::shared_ptr<CommandHistory> history)
+    : history_(std::move(history)), success_(false), result_(Result::NONE), count_(0),
+      undone_(0) {}
+
+bool RollbackCommand::execute(core::IOutputStream& output) {
+    if (!history_ || !history_->isGroupOpen()) {
+        success_ = false;
+        result_ = Result::NOT_OPEN;
+        writeResult(*this, output);
+
+        return false;
+    }
+    
+    count_ = history_->getGroupSize();
+    undone_ = history_->rollbackGroup();
+    success_ = undone_ == count_;
+    result_ = success_ ? Result::ROLLED_BACK : Result::PARTIAL;
+    writeResult(*this, output);
+
+    return success_;
+}
+
+std::string RollbackCommand::getResultMessage() const {
+    switch (result_) {
+        case Result::NOT_OPEN:
+            return "Error: No open transaction";
+        case Result::ROLLED_BACK:
+            return "[TRANSACTION] Rolled back " + std::to_string(undone_) + " actions";
+        case Result::PARTIAL:
+            return "Error: Rolled back only " + std::to_string(undone_) + " of " +
+                   std::to_string(count_) + " actions";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool RollbackCommand::wasSuccessful() const {
+    return success_;
+}
+
+} // namespace slideEditor::controller
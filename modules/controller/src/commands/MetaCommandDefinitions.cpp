@@ -5,42 +5,30 @@
 
 namespace slideEditor::controller {
 
-namespace {
-    CommandContext* getContext(void* contextPtr) {
-        if (!contextPtr) {
-            throw std::runtime_error("Context pointer is null");
-        }
-        return static_cast<CommandContext*>(contextPtr);
-    }
-}
-
 // ========================================
 // CreateMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createCreateMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        auto* context = getContext(contextPtr);
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         // Validate dependencies using interface
-        if (!context->hasRepository()) {
+        if (!context.hasRepository()) {
             throw std::runtime_error("Repository not available in context");
         }
         
-        auto repo = context->getRepository();
-        return std::make_unique<UndoableCreateCommand>(
+        const auto& repo = context.getRepository();
+        return UndoableCreateCommand(
             repo, 
-            args[0],  // title
-            args[1],  // content
-            args[2]   // theme
+            args[0].asString(),  // title
+            args[1].asString(),  // content
+            args[2].asString()   // theme
         );
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<UndoableCreateCommand>(
         "create", 
         "Creates a new slide with the specified title, content, and theme.",
         "ACTION",
-        creator,
+        factory,
         std::initializer_list<core::ArgumentInfo>{
             {"title", "identifier", "The slide title", true},
             {"content", "identifier", "The slide content", true},
@@ -53,34 +41,31 @@ std::unique_ptr<core::IMetaCommand> createCreateMetaCommand() {
 // AddShapeMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createAddShapeMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        auto* context = getContext(contextPtr);
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         // Validate dependencies
-        if (!context->hasRepository()) {
+        if (!context.hasRepository()) {
             throw std::runtime_error("Repository not available in context");
         }
         
-        auto repo = context->getRepository();
+        const auto& repo = context.getRepository();
         // Parse and validate arguments
-        int id = std::stoi(args[0]);
-        std::string type = args[1];
-        double scale = std::stod(args[2]);
+        int id = args[0].asInt();
+        std::string type = args[1].asString();
+        double scale = args[2].asDouble();
         // Optional color arguments with defaults
-        std::string borderColor = args.size() > 3 ? args[3] : "black";
-        std::string fillColor = args.size() > 4 ? args[4] : "white";
+        std::string borderColor = args.size() > 3 ? args[3].asString() : "black";
+        std::string fillColor = args.size() > 4 ? args[4].asString() : "white";
         
-        return std::make_unique<UndoableAddShapeCommand>(
+        return UndoableAddShapeCommand(
             repo, id, type, scale, borderColor, fillColor
         );
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<UndoableAddShapeCommand>(
         "addshape", 
         "Adds a shape to the slide with the given ID. Types: Circle, Rectangle, Triangle, Ellipse",
         "ACTION",
-        creator,
+        factory,
         std::initializer_list<core::ArgumentInfo>{
             {"id", "int", "The slide ID", true},
             {"type", "identifier", "Shape type (circle, rectangle, triangle, ellipse)", true},
@@ -95,28 +80,24 @@ std::unique_ptr<core::IMetaCommand> createAddShapeMetaCommand() {
 // RemoveShapeMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createRemoveShapeMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        auto* context = getContext(contextPtr);
-        
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         // Validate dependencies
-        if (!context->hasRepository()) {
+        if (!context.hasRepository()) {
             throw std::runtime_error("Repository not available in context");
         }
 
-        auto repo = context->getRepository();
-        int id = std::stoi(args[0]);
-        size_t index = std::stoull(args[1]);
+        const auto& repo = context.getRepository();
+        int id = args[0].asInt();
+        size_t index = static_cast<size_t>(args[1].asInt());
         
-        return std::make_unique<UndoableRemoveShapeCommand>(repo, id, index);
+        return UndoableRemoveShapeCommand(repo, id, index);
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<UndoableRemoveShapeCommand>(
         "removeshape", 
         "Removes the shape at the specified index from the slide.",
         "ACTION",
-        creator,
+        factory,
         std::initializer_list<core::ArgumentInfo>{
             {"id", "int", "The slide ID", true},
             {"index", "int", "The shape index to remove", true}
@@ -128,33 +109,28 @@ std::unique_ptr<core::IMetaCommand> createRemoveShapeMetaCommand() {
 // UndoMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createUndoMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         std::ignore = args; 
-        auto* context = getContext(contextPtr);
-        
         // Validate dependencies using interface
-        if (!context->hasHistory()) {
+        if (!context.hasHistory()) {
             throw std::runtime_error("CommandHistory not available in context");
         }
         
-        if (!context->hasView()) {
+        if (!context.hasView()) {
             throw std::runtime_error("View not available in context");
         }
         
-        auto* typedContext = static_cast<CommandContext*>(context);
-        auto history = typedContext->getHistoryTyped();
-        auto view = context->getView();
+        const auto& history = context.getHistoryTyped();
+        const auto& view = context.getView();
         
-        return std::make_unique<UndoCommand>(history, view);
+        return UndoCommand(history, view);
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<UndoCommand>(
         "undo", 
         "Undoes the last ACTION (structural change).",
         "META",
-        creator
+        factory
         // No arguments
     );
 }
@@ -163,33 +139,28 @@ std::unique_ptr<core::IMetaCommand> createUndoMetaCommand() {
 // RedoMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createRedoMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         std::ignore = args;  // No arguments
-        auto* context = getContext(contextPtr);
-        
         // Validate dependencies
-        if (!context->hasHistory()) {
+        if (!context.hasHistory()) {
             throw std::runtime_error("CommandHistory not available in context");
         }
         
-        if (!context->hasView()) {
+        if (!context.hasView()) {
             throw std::runtime_error("View not available in context");
         }
         
-        auto* typedContext = static_cast<CommandContext*>(context);
-        auto history = typedContext->getHistoryTyped();
-        auto view = context->getView();
+        const auto& history = context.getHistoryTyped();
+        const auto& view = context.getView();
         
-        return std::make_unique<RedoCommand>(history, view);
+        return RedoCommand(history, view);
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<RedoCommand>(
         "redo", 
         "Redoes the last undone ACTION.",
         "META",
-        creator
+        factory
         // No arguments
     );
 }
@@ -198,31 +169,27 @@ std::unique_ptr<core::IMetaCommand> createRedoMetaCommand() {
 // SaveMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createSaveMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        auto* context = getContext(contextPtr);
-        
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         // Validate dependencies
-        if (!context->hasRepository()) {
+        if (!context.hasRepository()) {
             throw std::runtime_error("Repository not available in context");
         }
         
-        if (!context->hasSerializer()) {
+        if (!context.hasSerializer()) {
             throw std::runtime_error("Serializer not available in context");
         }
         
-        auto repo = context->getRepository();
-        auto serializer = context->getSerializer();
+        const auto& repo = context.getRepository();
+        const auto& serializer = context.getSerializer();
         
-        return std::make_unique<SaveCommand>(repo, serializer, args[0]);
+        return SaveCommand(repo, serializer, args[0].asString());
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<SaveCommand>(
         "save", 
         "Saves the presentation to a JSON file.",
         "OPERATION",
-        creator,
+        factory,
         std::initializer_list<core::ArgumentInfo>{
             {"filename", "identifier", "The file to save to", true}
         }
@@ -233,31 +200,27 @@ std::unique_ptr<core::IMetaCommand> createSaveMetaCommand() {
 // LoadMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createLoadMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        auto* context = getContext(contextPtr);
-        
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         // Validate dependencies
-        if (!context->hasRepository()) {
+        if (!context.hasRepository()) {
             throw std::runtime_error("Repository not available in context");
         }
         
-        if (!context->hasSerializer()) {
+        if (!context.hasSerializer()) {
             throw std::runtime_error("Serializer not available in context");
         }
         
-        auto repo = context->getRepository();
-        auto serializer = context->getSerializer();
+        const auto& repo = context.getRepository();
+        const auto& serializer = context.getSerializer();
         
-        return std::make_unique<LoadCommand>(repo, serializer, args[0]);
+        return LoadCommand(repo, serializer, args[0].asString());
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<LoadCommand>(
         "load", 
         "Loads a presentation from a JSON file.",
         "OPERATION",
-        creator,
+        factory,
         std::initializer_list<core::ArgumentInfo>{
             {"filename", "identifier", "The file to load from", true}
         }
@@ -268,32 +231,28 @@ std::unique_ptr<core::IMetaCommand> createLoadMetaCommand() {
 // DisplayMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createDisplayMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         std::ignore = args;  // No arguments
-        auto* context = getContext(contextPtr);
-        
         // Validate dependencies
-        if (!context->hasRepository()) {
+        if (!context.hasRepository()) {
             throw std::runtime_error("Repository not available in context");
         }
         
-        if (!context->hasView()) {
+        if (!context.hasView()) {
             throw std::runtime_error("View not available in context");
         }
         
-        auto repo = context->getRepository();
-        auto view = context->getView();
+        const auto& repo = context.getRepository();
+        const auto& view = context.getView();
         
-        return std::make_unique<DisplayCommand>(repo, view);
+        return DisplayCommand(repo, view);
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<DisplayCommand>(
         "display", 
         "Displays all slides in the presentation with their details.",
         "QUERY",
-        creator
+        factory
         // No arguments
     );
 }
@@ -303,35 +262,183 @@ std::unique_ptr<core::IMetaCommand> createDisplayMetaCommand() {
 // ========================================
 
 std::unique_ptr<core::IMetaCommand> createDrawMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        auto* context = getContext(contextPtr);
-        
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         // Validate dependencies
-        if (!context->hasRepository()) {
+        if (!context.hasRepository()) {
             throw std::runtime_error("Repository not available in context");
         }
         
-        if (!context->hasView()) {
+        if (!context.hasView()) {
             throw std::runtime_error("View not available in context");
         }
         
-        auto repo = context->getRepository();
-        auto view = context->getView();
+        const auto& repo = context.getRepository();
+        const auto& view = context.getView();
+        const auto& cache = context.getRenderCache();  // May be null
+        auto options = context.hasRenderOptions() 
+            ? *context.getRenderOptions() 
+            : view::SvgOptions();
         // Optional filename argument
-        std::string filename = args.empty() ? "presentation.svg" : args[0];
-        
-        return std::make_unique<DrawCommand>(repo, view, filename);
+        std::string filename = args.empty() ? "presentation.svg" : args[0].asString();
+        // Optional slide range; a lone 'from' draws to the end of the deck
+        int fromSlide = args.size() > 1 ? args[1].asInt() : 0;
+        int toSlide = args.size() > 2 ? args[2].asInt() 
+                    : (fromSlide > 0 ? static_cast<int>(repo->getSlideCount()) : 0);
+        
+        // The live preview already shows the deck, so don't launch a browser per draw
+        bool previewRunning = context.hasPreviewServer() && 
+                              context.getPreviewServer()->isRunning();
+        
+        return DrawCommand(repo, view, filename, cache, options,
+                           fromSlide, toSlide, context.getRenderer(),
+                           !previewRunning);
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<DrawCommand>(
         "draw", 
-        "Generates an SVG file of the presentation and opens it in the browser.",
+        "Generates an SVG file of the presentation (or of slides from..to) and opens it in the browser.",
+        "OPERATION",
+        factory,
+        std::initializer_list<core::ArgumentInfo>{
+            {"filename", "identifier", "Output SVG filename (optional, default: presentation.svg)", false},
+            {"from", "int", "First slide to draw, 1-based (optional)", false},
+            {"to", "int", "Last slide to draw, inclusive (optional, default: last slide)", false}
+        }
+    );
+}
+
+// ========================================
+// DrawPagesMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createDrawPagesMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        // Validate dependencies
+        if (!context.hasRepository()) {
+            throw std::runtime_error("Repository not available in context");
+        }
+        
+        const auto& repo = context.getRepository();
+        const auto& cache = context.getRenderCache();  // May be null
+        auto options = context.hasRenderOptions() 
+            ? *context.getRenderOptions() 
+            : view::SvgOptions();
+        std::string basename = args[0].asString();
+        int pageSize = args[1].asInt();
+        
+        return DrawPagesCommand(repo, basename, pageSize, cache, options,
+                                context.getRenderer());
+    };
+    
+    return MetaCommand::create<DrawPagesCommand>(
+        "drawpages", 
+        "Writes the presentation as SVG pages of a fixed number of slides (<basename>-N.svg).",
+        "OPERATION",
+        factory,
+        std::initializer_list<core::ArgumentInfo>{
+            {"basename", "identifier", "Base filename for the pages", true},
+            {"pageSize", "int", "Slides per page", true}
+        }
+    );
+}
+
+// ========================================
+// DrawSplitMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createDrawSplitMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        // Validate dependencies
+        if (!context.hasRepository()) {
+            throw std::runtime_error("Repository not available in context");
+        }
+        
+        if (!context.hasSplitExporter()) {
+            throw std::runtime_error("Split exporter not available in context");
+        }
+        
+        const auto& repo = context.getRepository();
+        auto options = context.hasRenderOptions() 
+            ? *context.getRenderOptions() 
+            : view::SvgOptions();
+        
+        return DrawSplitCommand(repo, context.getSplitExporter(), 
+                                args[0].asString(), options);
+    };
+    
+    return MetaCommand::create<DrawSplitCommand>(
+        "drawsplit", 
+        "Writes one SVG per slide (slide-<id>.svg) and an index.html into a directory; unchanged slides are skipped.",
         "OPERATION",
-        creator,
+        factory,
         std::initializer_list<core::ArgumentInfo>{
-            {"filename", "identifier", "Output SVG filename (optional, default: presentation.svg)", false}
+            {"directory", "identifier", "Output directory", true}
+        }
+    );
+}
+
+// ========================================
+// ExportMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createExportMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        // Validate dependencies
+        if (!context.hasRepository()) {
+            throw std::runtime_error("Repository not available in context");
+        }
+        
+        const auto& repo = context.getRepository();
+        std::string filename = args[0].asString();
+        view::ImageFormat format = view::ImageFormat::PNG;
+        if (args.size() > 1 && !view::ImageWriter::parseFormat(args[1].asString(), format)) {
+            throw std::runtime_error("Unknown image format '" + args[1].asString() + "' (expected png or ppm)");
+        }
+        
+        // Optional slide range; a lone 'from' exports to the end of the deck
+        int fromSlide = args.size() > 2 ? args[2].asInt() : 0;
+        int toSlide = args.size() > 3 ? args[3].asInt() 
+                    : (fromSlide > 0 ? static_cast<int>(repo->getSlideCount()) : 0);
+        
+        // Same placement as draw
+        view::LayoutMode layout = context.hasRenderOptions() 
+            ? context.getRenderOptions()->layout 
+            : view::LayoutMode::GRID;
+        
+        return ExportCommand(repo, filename, format, fromSlide, toSlide, layout);
+    };
+    
+    return MetaCommand::create<ExportCommand>(
+        "export", 
+        "Rasterizes the presentation (or slides from..to) to a PNG or PPM image.",
+        "OPERATION",
+        factory,
+        std::initializer_list<core::ArgumentInfo>{
+            {"filename", "identifier", "Output image filename", true},
+            {"format", "identifier", "Image format: png or ppm (optional, default: png)", false},
+            {"from", "int", "First slide to export, 1-based (optional)", false},
+            {"to", "int", "Last slide to export, inclusive (optional, default: last slide)", false}
+        }
+    );
+}
+
+// ========================================
+// SvgModeMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createSvgModeMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        // Validate dependencies
+        if (!context.hasRenderOptions()) {
+            throw std::runtime_error("Render options not available in context");
+        }
+        
+        return SvgModeCommand(context.getRenderOptions(), args[0].asString());
+    };
+    
+    return MetaCommand::create<SvgModeCommand>(
+        "svgmode", 
+        "Selects the SVG output mode for draw: plain (default), defs (shared <defs>/<use>), classes (shared <style> classes) or compact (both).",
+        "OPERATION",
+        factory,
+        std::initializer_list<core::ArgumentInfo>{
+            {"mode", "identifier", "Output mode: plain, defs, classes or compact", true}
         }
     );
 }
@@ -340,34 +447,29 @@ std::unique_ptr<core::IMetaCommand> createDrawMetaCommand() {
 // HelpMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createHelpMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        auto* context = getContext(contextPtr);
-        
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
         // Validate dependencies
-        if (!context->hasRegistry()) {
+        if (!context.hasRegistry()) {
             throw std::runtime_error("CommandRegistry not available in context");
         }
         
-        if (!context->hasView()) {
+        if (!context.hasView()) {
             throw std::runtime_error("View not available in context");
         }
         
-        auto* typedContext = static_cast<CommandContext*>(context);
-        auto* registry = typedContext->getRegistryTyped();
-        auto view = context->getView();
+        auto* registry = context.getRegistryTyped();
+        const auto& view = context.getView();
 
         // Optional command argument
-        std::string specificCmd = args.empty() ? "" : args[0];
-        return std::make_unique<HelpCommand>(registry, view, specificCmd);
+        std::string specificCmd = args.empty() ? "" : args[0].asString();
+        return HelpCommand(registry, view, specificCmd);
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<HelpCommand>(
         "help", 
         "Shows help for all commands or a specific command.",
         "QUERY",
-        creator,
+        factory,
         std::initializer_list<core::ArgumentInfo>{
             {"command", "identifier", "Specific command to get help for", false}
         }
@@ -378,22 +480,117 @@ std::unique_ptr<core::IMetaCommand> createHelpMetaCommand() {
 // ExitMetaCommand
 // ========================================
 std::unique_ptr<core::IMetaCommand> createExitMetaCommand() {
-    auto creator = [](const std::vector<std::string>& args, void* contextPtr) 
-        -> std::unique_ptr<core::ICommand> 
-    {
-        std::ignore = args;       // No arguments
-        std::ignore = contextPtr; // No dependencies needed
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        std::ignore = args;     // No arguments
+        std::ignore = context;  // No dependencies needed
         
-        return std::make_unique<ExitCommand>();
+        return ExitCommand();
     };
     
-    return std::make_unique<MetaCommand>(
+    return MetaCommand::create<ExitCommand>(
         "exit", 
         "Exits the application.",
         "CONTROL",
-        creator
+        factory
+        // No arguments
+    );
+}
+
+// ========================================
+// PreviewMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createPreviewMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        // Validate dependencies
+        if (!context.hasRepository()) {
+            throw std::runtime_error("Repository not available in context");
+        }
+        
+        if (!context.hasPreviewServer()) {
+            throw std::runtime_error("Preview server not available in context");
+        }
+        
+        int port = args.empty() ? view::PreviewServer::DEFAULT_PORT : args[0].asInt();
+        
+        return PreviewCommand(context.getRepository(), 
+                              context.getPreviewServer(), port);
+    };
+    
+    return MetaCommand::create<PreviewCommand>(
+        "preview", 
+        "Serves a live preview on http://127.0.0.1:<port>/ that updates after every command.",
+        "OPERATION",
+        factory,
+        std::initializer_list<core::ArgumentInfo>{
+            {"port", "int", "Local port (optional, default: 8080)", false}
+        }
+    );
+}
+
+// ========================================
+// BeginMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createBeginMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        std::ignore = args;  // No arguments
+        if (!context.hasHistory()) {
+            throw std::runtime_error("CommandHistory not available in context");
+        }
+        
+        return BeginCommand(context.getHistoryTyped());
+    };
+    
+    return MetaCommand::create<BeginCommand>(
+        "begin", 
+        "Starts a transaction; actions until commit become one undo step.",
+        "META",
+        factory
+        // No arguments
+    );
+}
+
+// ========================================
+// CommitMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createCommitMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        std::ignore = args;  // No arguments
+        if (!context.hasHistory()) {
+            throw std::runtime_error("CommandHistory not available in context");
+        }
+        
+        return CommitCommand(context.getHistoryTyped());
+    };
+    
+    return MetaCommand::create<CommitCommand>(
+        "commit", 
+        "Ends the transaction, recording its actions as one undo step.",
+        "META",
+        factory
+        // No arguments
+    );
+}
+
+// ========================================
+// RollbackMetaCommand
+// ========================================
+std::unique_ptr<core::IMetaCommand> createRollbackMetaCommand() {
+    auto factory = [](core::ArgumentSpan args, CommandContext& context) {
+        std::ignore = args;  // No arguments
+        if (!context.hasHistory()) {
+            throw std::runtime_error("CommandHistory not available in context");
+        }
+        
+        return RollbackCommand(context.getHistoryTyped());
+    };
+    
+    return MetaCommand::create<RollbackCommand>(
+        "rollback", 
+        "Ends the transaction, undoing its actions.",
+        "META",
+        factory
         // No arguments
     );
 }
 
-} // namespace slideEditor::controller
\ No newline at end of file
+} // namespace slideEditor::controller
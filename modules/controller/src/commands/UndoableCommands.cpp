@@ -1,5 +1,7 @@
 #include "controller/commands/UndoableCommands.hpp"
+#include "controller/commands/ResultOutput.hpp"
 #include "../../model/include/model/SlideFactory.hpp"
+#include "io/OutputStream.hpp"
 #include <sstream>
 
 namespace slideEditor::controller {
@@ -13,10 +15,11 @@ UndoableCreateCommand::UndoableCreateCommand(
     std::string title,
     std::string content,
     std::string theme)
-    : repository_(repo), 
+    : repository_(std::move(repo)), 
       title_(std::move(title)), 
       content_(std::move(content)), 
       theme_(std::move(theme)),
+      result_(Result::NONE),
       createdId_(-1),
       executed_(false),
       success_(false) {}
@@ -24,8 +27,8 @@ UndoableCreateCommand::UndoableCreateCommand(
 bool UndoableCreateCommand::execute(core::IOutputStream& output) {
     if (!repository_) {
         success_ = false;
-        message_ = "Error: Repository not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_REPOSITORY;
+        writeResult(*this, output);
         return false;
     }
     
@@ -35,16 +38,14 @@ bool UndoableCreateCommand::execute(core::IOutputStream& output) {
     if (createdId_ > 0) {
         executed_ = true;
         success_ = true;
-        std::ostringstream oss;
-        oss << "[ACTION] Slide created successfully with ID: " << createdId_;
-        message_ = oss.str();
-        output.writeLine(message_);
+        result_ = Result::CREATED;
+        writeResult(*this, output);
         return true;
     }
     
     success_ = false;
-    message_ = "Error: Failed to create slide";
-    output.writeLine("[ERROR] " + message_);
+    result_ = Result::CREATE_FAILED;
+    writeResult(*this, output);
     return false;
 }
 
@@ -55,9 +56,7 @@ bool UndoableCreateCommand::undo() {
     
     bool removed = repository_->removeSlide(createdId_);
     if (removed) {
-        std::ostringstream oss;
-        oss << "[UNDO ACTION] Removed slide " << createdId_;
-        message_ = oss.str();
+        result_ = Result::UNDONE;
         return true;
     }
     
@@ -75,7 +74,20 @@ std::string UndoableCreateCommand::getDescription() const {
 }
 
 std::string UndoableCreateCommand::getResultMessage() const {
-    return message_;
+    switch (result_) {
+        case Result::NO_REPOSITORY:
+            return "Error: Repository not available";
+        case Result::CREATED:
+            return "[ACTION] Slide created successfully with ID: " + std::to_string(createdId_);
+        case Result::CREATE_FAILED:
+            return "Error: Failed to create slide";
+        case Result::UNDONE:
+            return "[UNDO ACTION] Removed slide " + std::to_string(createdId_);
+        case Result::NONE:
+            break;
+    }
+
+    return "";
 }
 
 bool UndoableCreateCommand::wasSuccessful() const {
@@ -93,7 +105,7 @@ UndoableAddShapeCommand::UndoableAddShapeCommand(
     double scale,
     std::string borderColor,
     std::string fillColor)
-    : repository_(repo),
+    : repository_(std::move(repo)),
       slideId_(slideId),
       shapeType_(std::move(shapeType)),
       borderColor_(std::move(borderColor)),
@@ -101,13 +113,14 @@ UndoableAddShapeCommand::UndoableAddShapeCommand(
       scale_(scale),
       addedShapeIndex_(0),
       executed_(false),
-      success_(false) {}
+      success_(false),
+      result_(Result::NONE) {}
 
 bool UndoableAddShapeCommand::execute(core::IOutputStream& output) {
     if (!repository_) {
         success_ = false;
-        message_ = "Error: Repository not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_REPOSITORY;
+        writeResult(*this, output);
         
         return false;
     }
@@ -115,10 +128,8 @@ bool UndoableAddShapeCommand::execute(core::IOutputStream& output) {
     core::ISlide* slide = repository_->getSlide(slideId_);
     if (!slide) {
         success_ = false;
-        std::ostringstream oss;
-        oss << "Error: Slide with ID " << slideId_ << " not found";
-        message_ = oss.str();
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::SLIDE_NOT_FOUND;
+        writeResult(*this, output);
         
         return false;
     }
@@ -126,8 +137,8 @@ bool UndoableAddShapeCommand::execute(core::IOutputStream& output) {
     auto shape = model::SlideFactory::createShape(shapeType_, scale_, borderColor_, fillColor_);
     if (!shape) {
         success_ = false;
-        message_ = "Error: Invalid shape type '" + shapeType_ + "'";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::INVALID_SHAPE;
+        writeResult(*this, output);
         
         return false;
     }
@@ -137,11 +148,8 @@ bool UndoableAddShapeCommand::execute(core::IOutputStream& output) {
     slide->addShape(std::move(shape));
     executed_ = true;
     success_ = true;
-    std::ostringstream oss;
-    oss << "[ACTION] Shape '" << shapeType_ << "' (border: " << borderColor_ 
-        << ", fill: " << fillColor_ << ") added to slide " << slideId_;
-    message_ = oss.str();
-    output.writeLine(message_);
+    result_ = Result::ADDED;
+    writeResult(*this, output);
 
     return true;
 }
@@ -158,9 +166,7 @@ bool UndoableAddShapeCommand::undo() {
     
     bool removed = slide->removeShape(addedShapeIndex_);
     if (removed) {
-        std::ostringstream oss;
-        oss << "[UNDO ACTION] Removed shape from slide " << slideId_;
-        message_ = oss.str();
+        result_ = Result::UNDONE;
     
         return true;
     }
@@ -180,7 +186,27 @@ std::string UndoableAddShapeCommand::getDescription() const {
 }
 
 std::string UndoableAddShapeCommand::getResultMessage() const {
-    return message_;
+    std::ostringstream oss;
+    switch (result_) {
+        case Result::NO_REPOSITORY:
+            return "Error: Repository not available";
+        case Result::SLIDE_NOT_FOUND:
+            oss << "Error: Slide with ID " << slideId_ << " not found";
+            break;
+        case Result::INVALID_SHAPE:
+            return "Error: Invalid shape type '" + shapeType_ + "'";
+        case Result::ADDED:
+            oss << "[ACTION] Shape '" << shapeType_ << "' (border: " << borderColor_
+                << ", fill: " << fillColor_ << ") added to slide " << slideId_;
+            break;
+        case Result::UNDONE:
+            oss << "[UNDO ACTION] Removed shape from slide " << slideId_;
+            break;
+        case Result::NONE:
+            break;
+    }
+
+    return oss.str();
 }
 
 bool UndoableAddShapeCommand::wasSuccessful() const {
@@ -195,36 +221,33 @@ UndoableRemoveShapeCommand::UndoableRemoveShapeCommand(
     std::shared_ptr<core::ISlideRepository> repo,
     int slideId,
     size_t shapeIndex)
-    : repository_(repo),
+    : repository_(std::move(repo)),
       slideId_(slideId),
       shapeIndex_(shapeIndex),
       executed_(false),
-      success_(false) {}
+      success_(false),
+      result_(Result::NONE) {}
 
 bool UndoableRemoveShapeCommand::execute(core::IOutputStream& output) {
     if (!repository_) {
         success_ = false;
-        message_ = "Error: Repository not available";
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::NO_REPOSITORY;
+        writeResult(*this, output);
         return false;
     }
     
     core::ISlide* slide = repository_->getSlide(slideId_);
     if (!slide) {
         success_ = false;
-        std::ostringstream oss;
-        oss << "Error: Slide with ID " << slideId_ << " not found";
-        message_ = oss.str();
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::SLIDE_NOT_FOUND;
+        writeResult(*this, output);
         return false;
     }
     
     if (shapeIndex_ >= slide->getShapeCount()) {
         success_ = false;
-        std::ostringstream oss;
-        oss << "Error: Shape index " << shapeIndex_ << " out of range";
-        message_ = oss.str();
-        output.writeLine("[ERROR] " + message_);
+        result_ = Result::INDEX_OUT_OF_RANGE;
+        writeResult(*this, output);
         return false;
     }
     
@@ -236,17 +259,14 @@ bool UndoableRemoveShapeCommand::execute(core::IOutputStream& output) {
     if (removed) {
         executed_ = true;
         success_ = true;
-        std::ostringstream oss;
-        oss << "[ACTION] Shape at index " << shapeIndex_ 
-            << " removed from slide " << slideId_;
-        message_ = oss.str();
-        output.writeLine(message_);
+        result_ = Result::REMOVED;
+        writeResult(*this, output);
         return true;
     }
     
     success_ = false;
-    message_ = "Error: Failed to remove shape";
-    output.writeLine("[ERROR] " + message_);
+    result_ = Result::REMOVE_FAILED;
+    writeResult(*this, output);
     return false;
 }
 
@@ -261,9 +281,7 @@ bool UndoableRemoveShapeCommand::undo() {
     // Re-add the shape
     slide->addShape(removedShape_->clone());
     
-    std::ostringstream oss;
-    oss << "[UNDO ACTION] Restored shape to slide " << slideId_;
-    message_ = oss.str();
+    result_ = Result::UNDONE;
     return true;
 }
 
@@ -278,11 +296,128 @@ std::string UndoableRemoveShapeCommand::getDescription() const {
 }
 
 std::string UndoableRemoveShapeCommand::getResultMessage() const {
-    return message_;
+    std::ostringstream oss;
+    switch (result_) {
+        case Result::NO_REPOSITORY:
+            return "Error: Repository not available";
+        case Result::SLIDE_NOT_FOUND:
+            oss << "Error: Slide with ID " << slideId_ << " not found";
+            break;
+        case Result::INDEX_OUT_OF_RANGE:
+            oss << "Error: Shape index " << shapeIndex_ << " out of range";
+            break;
+        case Result::REMOVED:
+            oss << "[ACTION] Shape at index " << shapeIndex_
+                << " removed from slide " << slideId_;
+            break;
+        case Result::REMOVE_FAILED:
+            return "Error: Failed to remove shape";
+        case Result::UNDONE:
+            oss << "[UNDO ACTION] Restored shape to slide " << slideId_;
+            break;
+        case Result::NONE:
+            break;
+    }
+
+    return oss.str();
 }
 
 bool UndoableRemoveShapeCommand::wasSuccessful() const {
     return success_;
 }
 
-} // namespace slideEditor::core
\ No newline at end of file
+// ========================================
+// UndoableGroupCommand (ACTION)
+// ========================================
+
+UndoableGroupCommand::UndoableGroupCommand(
+    std::vector<std::unique_ptr<core::IUndoableCommand>> actions)
+    : actions_(std::move(actions)),
+      executed_(true),
+      success_(true),
+      result_(Result::NONE) {}
+
+bool UndoableGroupCommand::execute(core::IOutputStream& output) {
+    size_t done = 0;
+    for (auto& action : actions_) {
+        if (!action->execute(output)) {
+            break;
+        }
+        ++done;
+    }
+    
+    if (done < actions_.size()) {
+        // Leave the model as it was before this call
+        for (size_t i = done; i > 0; --i) {
+            actions_[i - 1]->undo();
+        }
+        success_ = false;
+        result_ = Result::REDO_FAILED;
+        writeResult(*this, output);
+        return false;
+    }
+    
+    executed_ = true;
+    success_ = true;
+    result_ = Result::APPLIED;
+    return true;
+}
+
+bool UndoableGroupCommand::undo() {
+    if (!executed_) {
+        return false;
+    }
+    
+    size_t remaining = actions_.size();
+    while (remaining > 0 && actions_[remaining - 1]->undo()) {
+        --remaining;
+    }
+    
+    if (remaining > 0) {
+        // Leave the model as it was before this call; the caller reports the failure
+        io::OutputStream sink;
+        sink.setVerbosity(core::Verbosity::QUIET);
+        for (size_t i = remaining; i < actions_.size(); ++i) {
+            actions_[i]->execute(sink);
+        }
+        return false;
+    }
+    
+    executed_ = false;
+    result_ = Result::UNDONE;
+    return true;
+}
+
+bool UndoableGroupCommand::canUndo() const {
+    return executed_ && !actions_.empty();
+}
+
+std::string UndoableGroupCommand::getDescription() const {
+    return "Group of " + std::to_string(actions_.size()) + " actions";
+}
+
+std::string UndoableGroupCommand::getResultMessage() const {
+    const std::string count = std::to_string(actions_.size());
+    switch (result_) {
+        case Result::APPLIED:
+            return "[ACTION] Group of " + count + " actions applied";
+        case Result::REDO_FAILED:
+            return "Error: Failed to redo group of " + count + " actions";
+        case Result::UNDONE:
+            return "[UNDO ACTION] Undid group of " + count + " actions";
+        case Result::NONE:
+            break;
+    }
+
+    return "";
+}
+
+bool UndoableGroupCommand::wasSuccessful() const {
+    return success_;
+}
+
+size_t UndoableGroupCommand::getActionCount() const {
+    return actions_.size();
+}
+
+} // namespace slideEditor::core
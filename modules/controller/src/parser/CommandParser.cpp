@@ -1,5 +1,6 @@
 #include "controller/parser/CommandParser.hpp"
 #include "controller/CommandRegistry.hpp"  
+#include "controller/parser/KeywordTable.hpp"
 #include <algorithm>
 #include <stdexcept>
 
@@ -19,7 +20,38 @@ CommandParser::CommandParser(core::IInputStream* input)
     advance(); // initialize currentToken_ with the first meaningful token 
 }
 
+CommandParser::CommandParser()
+    : currentToken_(TokenType::END_OF_FILE),
+      registry_(nullptr) {}
+
+void CommandParser::reset() {
+    if (lexer_) {
+        lexer_->reset();
+    } 
+    else {
+        spanLexer_.reset(spanLexer_.text());
+    }
+    
+    advance();
+}
+
+void CommandParser::reset(std::string_view text) {
+    lexer_.reset();
+    spanLexer_.reset(text);
+    advance();
+}
+
 void CommandParser::advance() {
+    if (!lexer_) {
+        SpanToken token = spanLexer_.nextToken();
+        while (token.type == TokenType::END_OF_LINE) {
+            token = spanLexer_.nextToken();
+        }
+        
+        currentToken_ = spanLexer_.toToken(token);
+        return;
+    }
+    
     // FIXED: This loop skips over END_OF_LINE tokens to get the next meaningful token
     // The tokens come from lexer_->nextToken() which reads from the input stream
     // The loop continues until we get a token that's not END_OF_LINE
@@ -89,10 +121,17 @@ ParsedCommand CommandParser::parseCommand() {
         return result;
     }
     
-    // Extract command name and normalize to lowercase
+    // Extract command name and normalize to lowercase; keywords take the
+    // table's spelling, which fits the small-string buffer
     std::string cmdName = currentToken_.asString();
-    std::transform(cmdName.begin(), cmdName.end(), cmdName.begin(),
-                   [](unsigned char c){ return std::tolower(c); });
+    const int keyword = keywords::find(cmdName);
+    if (keyword != keywords::kNotFound) {
+        cmdName = keywords::kNames[keyword];
+    } 
+    else {
+        std::transform(cmdName.begin(), cmdName.end(), cmdName.begin(),
+                       [](unsigned char c){ return std::tolower(c); });
+    }
     
     result.commandName = cmdName;
     
@@ -158,9 +197,8 @@ ParsedCommand CommandParser::parseCommand() {
         return result;
     }
     
-    // Validate using metadata (optional additional validation)
-    auto argStrings = result.getArgumentStrings();
-    if (!metaCmd->validateArguments(argStrings)) {
+    // Validate using metadata; the values are already typed
+    if (!metaCmd->validateParsedArguments(result.arguments)) {
         result.isValid = false;
         result.errorMessage = "Invalid arguments for command: " + cmdName;
 
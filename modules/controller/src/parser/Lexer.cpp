@@ -1,4 +1,5 @@
 #include "controller/parser/Lexer.hpp"
+#include "controller/parser/KeywordTable.hpp"
 #include <cctype>
 #include <stdexcept>
 #include <algorithm>
@@ -50,6 +51,8 @@ Token Lexer::nextToken() {
     
     size_t tokenStartLine = line_;
     size_t tokenStartCol = column_;
+    // The delimiter moves the machine back to START, so remember what the token was
+    LexerState tokenState = LexerState::START;
     while (!input_->eof()) {
         auto maybeChar = input_->peek();
         if (!maybeChar.has_value()) {
@@ -75,6 +78,7 @@ Token Lexer::nextToken() {
             input_->get();
             buffer_ += c;
             ++column_;
+            tokenState = nextState;
         } 
         else if (nextState == LexerState::IN_WHITESPACE) {
             input_->get();
@@ -90,7 +94,7 @@ Token Lexer::nextToken() {
         return createEOFToken();
     }
     
-    LexerState finalState = stateMachine_.getCurrentState();    
+    LexerState finalState = tokenState;
     if (finalState == LexerState::IN_IDENTIFIER) {
         Token tok = createIdentifierToken();
         tok.line = tokenStartLine;
@@ -131,6 +135,13 @@ std::vector<Token> Lexer::tokenizeAll() {
     return tokens;
 }
 
+void Lexer::reset() {
+    stateMachine_.reset();
+    clearBuffer();
+    line_ = 1;
+    column_ = 1;
+}
+
 Token Lexer::createIdentifierToken() {
     TokenType type = isCommandKeyword(buffer_) ? TokenType::COMMAND : TokenType::IDENTIFIER;
     return Token(type, buffer_, line_, column_);
@@ -165,22 +176,7 @@ void Lexer::clearBuffer() {
 }
 
 bool Lexer::isCommandKeyword(const std::string& word) const {
-    static const std::vector<std::string> keywords = {
-        "create", "addshape", "removeshape", "save", 
-        "load", "display", "help", "draw", "exit", "undo", "redo"
-    };
-    
-    std::string lower = word;
-    std::transform(lower.begin(), lower.end(), lower.begin(),
-                   [](unsigned char c){ return std::tolower(c); });
-    
-    for (const auto& kw : keywords) {
-        if (lower == kw) {
-            return true;
-        }
-    }
-
-    return false;
+    return keywords::isKeyword(word);
 }
 
 size_t Lexer::getLine() const {
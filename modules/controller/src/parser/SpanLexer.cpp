@@ -0,0 +1,231 @@
+#include "controller/parser/SpanLexer.hpp"
+#include "controller/parser/KeywordTable.hpp"
+#include <array>
+#include <charconv>
+#include <string>
+#include <system_error>
+
+namespace slideEditor::controller {
+
+namespace {
+
+// Same classes as LexerStateMachine, looked up inline per character
+enum CharClass : uint8_t {
+    OTHER = 0,
+    ALPHA = 1,
+    DIGIT = 2,
+    BLANK = 4,     // Space or tab
+    NEWLINE = 8
+};
+
+constexpr std::array<uint8_t, 256> makeClassTable() {
+    std::array<uint8_t, 256> table{};
+    for (int c = 'a'; c <= 'z'; ++c) {
+        table[c] = ALPHA;
+    }
+    for (int c = 'A'; c <= 'Z'; ++c) {
+        table[c] = ALPHA;
+    }
+    for (int c = '0'; c <= '9'; ++c) {
+        table[c] = DIGIT;
+    }
+    
+    table['_'] = ALPHA;
+    table[' '] = BLANK;
+    table['\t'] = BLANK;
+    table['\n'] = NEWLINE;
+    table['\r'] = NEWLINE;
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> kClass = makeClassTable();
+
+inline uint8_t classOf(char c) {
+    return kClass[static_cast<unsigned char>(c)];
+}
+
+} // namespace
+
+SpanLexer::SpanLexer(std::string_view text) {
+    reset(text);
+}
+
+void SpanLexer::reset(std::string_view text) {
+    text_ = text;
+    position_ = 0;
+    line_ = 1;
+    column_ = 1;
+}
+
+SpanToken SpanLexer::nextToken() {
+    const char* data = text_.data();
+    const size_t size = text_.size();
+
+    // Skip spaces and tabs; newlines are tokens
+    while (position_ < size && classOf(data[position_]) == BLANK) {
+        ++position_;
+        ++column_;
+    }
+
+    if (position_ >= size) {
+        return makeToken(TokenType::END_OF_FILE, position_, column_);
+    }
+
+    const uint8_t cls = classOf(data[position_]);
+    if (cls == NEWLINE) {
+        SpanToken token = makeToken(TokenType::END_OF_LINE, position_, column_);
+        token.length = 1;
+        ++position_;
+        ++line_;
+        column_ = 1;
+        return token;
+    }
+
+    if (cls == ALPHA) {
+        return lexIdentifier(position_, column_);
+    }
+
+    if (cls == DIGIT) {
+        return lexNumber(position_, column_);
+    }
+
+    return makeError("Invalid character", position_, column_);
+}
+
+SpanToken SpanLexer::lexIdentifier(size_t start, size_t startColumn) {
+    const char* data = text_.data();
+    const size_t size = text_.size();
+    while (position_ < size && (classOf(data[position_]) & (ALPHA | DIGIT))) {
+        ++position_;
+    }
+
+    column_ += position_ - start;
+    // Like Lexer, a token must end at whitespace or the end of the text
+    if (position_ < size && !(classOf(data[position_]) & (BLANK | NEWLINE))) {
+        return makeError("Invalid character", position_, column_);
+    }
+
+    SpanToken token = makeToken(TokenType::IDENTIFIER, start, startColumn);
+    token.length = static_cast<uint32_t>(position_ - start);
+    token.keyword = keywords::find(textOf(token));
+    if (token.keyword != keywords::kNotFound) {
+        token.type = TokenType::COMMAND;
+    }
+
+    return token;
+}
+
+SpanToken SpanLexer::lexNumber(size_t start, size_t startColumn) {
+    const char* data = text_.data();
+    const size_t size = text_.size();
+    bool decimal = false;
+    while (position_ < size) {
+        const char c = data[position_];
+        if (classOf(c) == DIGIT) {
+            ++position_;
+        }
+        else if (c == '.' && !decimal) {
+            decimal = true;
+            ++position_;
+        }
+        else {
+            break;
+        }
+    }
+
+    column_ += position_ - start;
+    if (position_ < size && !(classOf(data[position_]) & (BLANK | NEWLINE))) {
+        return makeError("Invalid character", position_, column_);
+    }
+
+    SpanToken token = makeToken(TokenType::NUMBER, start, startColumn);
+    token.length = static_cast<uint32_t>(position_ - start);
+    const char* first = data + start;
+    const char* last = data + position_;
+    if (decimal) {
+        auto [ptr, ec] = std::from_chars(first, last, token.doubleValue);
+        if (ec != std::errc() || ptr != last) {
+            return makeError("Number out of range", start, startColumn);
+        }
+        token.intValue = static_cast<int>(token.doubleValue);
+    }
+    else {
+        auto [ptr, ec] = std::from_chars(first, last, token.intValue);
+        if (ec != std::errc() || ptr != last) {
+            return makeError("Number out of range", start, startColumn);
+        }
+        token.isInteger = true;
+        token.doubleValue = static_cast<double>(token.intValue);
+    }
+
+    return token;
+}
+
+std::vector<SpanToken> SpanLexer::tokenizeAll() {
+    std::vector<SpanToken> tokens;
+    while (true) {
+        SpanToken token = nextToken();
+        tokens.push_back(token);
+        if (token.type == TokenType::END_OF_FILE ||
+            token.type == TokenType::ERROR) {
+            break;
+        }
+    }
+
+    return tokens;
+}
+
+std::string_view SpanLexer::text() const {
+    return text_;
+}
+
+std::string_view SpanLexer::textOf(const SpanToken& token) const {
+    return text_.substr(token.offset, token.length);
+}
+
+Token SpanLexer::toToken(const SpanToken& token) const {
+    const size_t line = token.line;
+    const size_t column = token.column;
+    switch (token.type) {
+        case TokenType::COMMAND:
+            // The table's lowercase spelling; it fits the small-string buffer
+            return Token(token.type, std::string(keywords::kNames[token.keyword]),
+                         line, column);
+        case TokenType::IDENTIFIER:
+            return Token(token.type, std::string(textOf(token)), line, column);
+        case TokenType::NUMBER:
+            if (token.isInteger) {
+                return Token(token.type, token.intValue, line, column);
+            }
+            return Token(token.type, token.doubleValue, line, column);
+        case TokenType::ERROR:
+            return Token(token.type, std::string(token.error), line, column);
+        default:
+            return Token(token.type, line, column);
+    }
+}
+
+SpanToken SpanLexer::makeToken(TokenType type, size_t start, size_t startColumn) const {
+    SpanToken token;
+    token.type = type;
+    token.offset = start;
+    token.line = static_cast<uint32_t>(line_);
+    token.column = static_cast<uint32_t>(startColumn);
+    return token;
+}
+
+SpanToken SpanLexer::makeError(const char* message, size_t start, size_t startColumn) const {
+    SpanToken token = makeToken(TokenType::ERROR, start, startColumn);
+    token.error = message;
+    return token;
+}
+
+size_t SpanLexer::getLine() const {
+    return line_;
+}
+
+size_t SpanLexer::getColumn() const {
+    return column_;
+}
+
+} // namespace slideEditor::controller
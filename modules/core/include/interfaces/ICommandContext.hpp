@@ -15,13 +15,13 @@ public:
     virtual ~ICommandContext() = default;
     
     virtual bool hasRepository() const = 0;
-    virtual std::shared_ptr<ISlideRepository> getRepository() const = 0;
+    virtual const std::shared_ptr<ISlideRepository>& getRepository() const = 0;
     
     virtual bool hasSerializer() const = 0;
-    virtual std::shared_ptr<ISerializer> getSerializer() const = 0;
+    virtual const std::shared_ptr<ISerializer>& getSerializer() const = 0;
     
     virtual bool hasView() const = 0;
-    virtual std::shared_ptr<IView> getView() const = 0;
+    virtual const std::shared_ptr<IView>& getView() const = 0;
     
     virtual bool hasHistory() const = 0;
     virtual void* getHistory() const = 0;  // Returns CommandHistory* as void*
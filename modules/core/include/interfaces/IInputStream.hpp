@@ -1,7 +1,9 @@
 #ifndef I_INPUT_STREAM_HPP
 #define I_INPUT_STREAM_HPP
 
+#include <cstddef>
 #include <optional>
+#include <string>
 
 namespace slideEditor::core {
 
@@ -15,8 +17,52 @@ public:
     
     // Position control (optional for some implementations)
     virtual void unget() = 0;
+    
+    // Bulk reads. The defaults go through get()/peek(); buffered streams override them.
+    
+    // Copies up to size characters into buffer; returns how many were read, 0 at end of input
+    virtual size_t read(char* buffer, size_t size) {
+        size_t count = 0;
+        while (count < size) {
+            auto c = get();
+            if (!c.has_value()) {
+                break;
+            }
+            buffer[count++] = *c;
+        }
+        
+        return count;
+    }
+    
+    // Replaces line with the characters up to "\n", "\r\n" or "\r", which is consumed
+    // but not stored. Returns false only at end of input with nothing left to read.
+    virtual bool readLine(std::string& line) {
+        line.clear();
+        auto c = get();
+        if (!c.has_value()) {
+            return false;
+        }
+        
+        while (c.has_value()) {
+            if (*c == '\n') {
+                break;
+            }
+            if (*c == '\r') {
+                auto next = peek();
+                if (next.has_value() && *next == '\n') {
+                    get();
+                }
+                break;
+            }
+            
+            line += *c;
+            c = get();
+        }
+        
+        return true;
+    }
 };
 
 } // namespace slideEditor::core
 
-#endif // I_INPUT_STREAM_HPP
\ No newline at end of file
+#endif // I_INPUT_STREAM_HPP
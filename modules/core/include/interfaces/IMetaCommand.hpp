@@ -2,6 +2,8 @@
 #define I_META_COMMAND_HPP
 
 #include <string>
+#include <string_view>
+#include <variant>
 #include <vector>
 #include <functional>
 #include <memory>
@@ -21,8 +23,75 @@ struct ArgumentInfo {
           description(std::move(desc)), required(req) {}
 };
 
+// One argument as the parser converted it, according to its ArgumentInfo type
+struct CommandArgument {
+    std::variant<int, double, std::string> value;
+    std::string_view type;  // "int", "double", "string"
+    
+    CommandArgument() : value(std::string()), type("string") {}
+    
+    explicit CommandArgument(int v) : value(v), type("int") {}
+    explicit CommandArgument(double v) : value(v), type("double") {}
+    explicit CommandArgument(std::string v) : value(std::move(v)), type("string") {}
+    
+    int asInt() const {
+        if (std::holds_alternative<int>(value)) {
+            return std::get<int>(value);
+        } 
+        else if (std::holds_alternative<double>(value)) {
+            return static_cast<int>(std::get<double>(value));
+        } 
+        else {
+            return std::stoi(std::get<std::string>(value));
+        }
+    }
+    
+    double asDouble() const {
+        if (std::holds_alternative<double>(value)) {
+            return std::get<double>(value);
+        } 
+        else if (std::holds_alternative<int>(value)) {
+            return static_cast<double>(std::get<int>(value));
+        } 
+        else {
+            return std::stod(std::get<std::string>(value));
+        }
+    }
+    
+    std::string asString() const {
+        if (std::holds_alternative<std::string>(value)) {
+            return std::get<std::string>(value);
+        } 
+        else if (std::holds_alternative<int>(value)) {
+            return std::to_string(std::get<int>(value));
+        } 
+        else {
+            return std::to_string(std::get<double>(value));
+        }
+    }
+};
+
+// Non-owning view of parsed arguments, in ArgumentInfo order
+class ArgumentSpan {
+public:
+    ArgumentSpan() = default;
+    ArgumentSpan(const CommandArgument* data, size_t size) : data_(data), size_(size) {}
+    ArgumentSpan(const std::vector<CommandArgument>& args) : data_(args.data()), size_(args.size()) {}
+    
+    const CommandArgument& operator[](size_t index) const { return data_[index]; }
+    const CommandArgument* begin() const { return data_; }
+    const CommandArgument* end() const { return data_ + size_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+private:
+    const CommandArgument* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Creators get each value already typed, so nothing is parsed twice
 using CommandCreator = std::function<std::unique_ptr<ICommand>(
-    const std::vector<std::string>& args,
+    ArgumentSpan args,
     void* context
 )>;
 
@@ -42,7 +111,10 @@ public:
     virtual size_t getRequiredArgCount() const = 0;
     virtual size_t getMaxArgCount() const = 0;
     
+    // Checks textual arguments, e.g. from a source other than CommandParser
     virtual bool validateArguments(const std::vector<std::string>& args) const = 0;
+    // Checks count and types of arguments the parser already converted
+    virtual bool validateParsedArguments(ArgumentSpan args) const = 0;
     
     // Help generation
     virtual std::string getUsage() const = 0;
@@ -5,6 +5,11 @@
 
 namespace slideEditor::core {
 
+enum class Verbosity {
+    QUIET,   // Errors only; commands skip rendering anything else
+    NORMAL
+};
+
 class IOutputStream {
 public:
     virtual ~IOutputStream() = default;
@@ -15,8 +20,10 @@ public:
     
     virtual bool good() const = 0;
     virtual bool fail() const = 0;
+    
+    virtual Verbosity getVerbosity() const = 0;
 };
 
 } // namespace slideEditor::core
 
-#endif // I_OUTPUT_STREAM_HPP
\ No newline at end of file
+#endif // I_OUTPUT_STREAM_HPP
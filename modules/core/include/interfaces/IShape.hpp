@@ -2,6 +2,7 @@
 #define I_SHAPE_HPP
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <algorithm>
 
@@ -66,6 +67,10 @@ public:
     virtual std::unique_ptr<IShape> clone() const = 0;
     // SVG generation
     virtual std::string toSVG(double x, double y) const = 0;
+    virtual void appendSVG(std::string& out, double x, double y) const = 0;  // appends to out
+    // Stylesheet variant: the element references styleClass, whose rule appendStyleRule writes
+    virtual void appendSVG(std::string& out, double x, double y, std::string_view styleClass) const = 0;
+    virtual void appendStyleRule(std::string& out) const = 0;
 };
 
 } // namespace slideEditor::core
@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstdint>
 
 namespace slideEditor::core {
 
@@ -13,14 +14,17 @@ public:
     virtual ~ISlide() = default;
     
     virtual int getId() const = 0;
-    virtual std::string getTitle() const = 0;
-    virtual std::string getContent() const = 0;
-    virtual std::string getTheme() const = 0;
+    virtual void setId(int id) = 0;  // Assigned by the repository that owns the slide
+    virtual const std::string& getTitle() const = 0;
+    virtual const std::string& getContent() const = 0;
+    virtual const std::string& getTheme() const = 0;
     virtual const std::vector<std::unique_ptr<IShape>>& getShapes() const = 0;
     virtual void addShape(std::unique_ptr<IShape> shape) = 0;
     virtual bool removeShape(size_t index) = 0;
     virtual size_t getShapeCount() const = 0;
     virtual std::string serialize() const = 0;
+    // Content version, changes on every mutation (used to invalidate render caches)
+    virtual std::uint64_t getVersion() const = 0;
 };
 
 } // namespace slideEditor::core
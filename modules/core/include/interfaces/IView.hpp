@@ -15,6 +15,7 @@ public:
     virtual void displaySlides(const ISlideRepository* repository) = 0;
     virtual void displayHelp(const std::string& helpText) = 0;
     virtual void displayPrompt() = 0;
+    virtual void flush() = 0;
 };
 
 } // namespace slideEditor::core
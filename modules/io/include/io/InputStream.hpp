@@ -8,9 +8,24 @@
 
 namespace slideEditor::io {
 
+/**
+ * InputStream - Buffered input over an std::istream or a string
+ *
+ * Characters are taken from the stream's buffer in blocks and served from
+ * an internal buffer, so get()/peek() are not an istream call each and
+ * readLine() finds line ends with memchr.
+ */
 class InputStream : public core::IInputStream {
 public:
-    explicit InputStream(std::istream& stream);
+    // How the buffer is refilled from an std::istream
+    enum class FillMode {
+        AVAILABLE,  // What the stream has ready, at least one character; safe for terminals
+        BLOCK       // Full BLOCK_SIZE reads, waiting for them; for files and piped batch input
+    };
+    
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+    
+    explicit InputStream(std::istream& stream, FillMode mode = FillMode::AVAILABLE);
     explicit InputStream(const std::string& str);
     ~InputStream() override;
     
@@ -19,16 +34,23 @@ public:
     bool eof() const override;
     bool good() const override;
     void unget() override;
+    
+    size_t read(char* buffer, size_t size) override;
+    bool readLine(std::string& line) override;
 
 private:
-    std::istream* stream_;
-    bool ownsStream_;
-    char lastChar_;
-    bool hasUnget_;
-
-    std::unique_ptr<std::istream> ownedStream_;
+    std::istream* stream_;  // Null once exhausted, or for a string
+    FillMode mode_;
+    std::unique_ptr<char[]> buffer_;
+    size_t capacity_;
+    size_t position_;
+    size_t end_;
+    size_t begin_;  // First valid character; unget() stops here
+    
+    // Refills an empty buffer; false at end of input
+    bool ensure();
 };
 
 } // namespace slideEditor::io
 
-#endif // INPUT_STREAM_HPP
\ No newline at end of file
+#endif // INPUT_STREAM_HPP
@@ -5,12 +5,20 @@
 // #include "interfaces/IOutputStream.hpp"
 #include <ostream>
 #include <memory>
+#include <string>
 
 namespace slideEditor::io {
 
 class OutputStream : public core::IOutputStream {
 public:
-    explicit OutputStream(std::ostream& stream);
+    enum class Buffering {
+        NONE,  // Every write goes straight to the stream
+        FULL   // Writes collect in memory until flush() or BUFFER_CAPACITY bytes
+    };
+    
+    static constexpr size_t BUFFER_CAPACITY = 64 * 1024;
+    
+    explicit OutputStream(std::ostream& stream, Buffering buffering = Buffering::NONE);
     OutputStream();
     ~OutputStream() override;
     
@@ -20,14 +28,22 @@ public:
     bool good() const override;
     bool fail() const override;
     
+    core::Verbosity getVerbosity() const override;
+    void setVerbosity(core::Verbosity verbosity);
+    
     std::string getOutput() const;
 
 private:
     std::unique_ptr<std::ostream> ownedStream_;
     std::ostream* stream_;
     bool ownsStream_;
+    Buffering buffering_;
+    core::Verbosity verbosity_;
+    std::string pending_;  // FULL only: written but not yet passed to stream_
+    
+    void drain();
 };
 
 } // namespace slideEditor::io
 
-#endif // OUTPUT_STREAM_HPP
\ No newline at end of file
+#endif // OUTPUT_STREAM_HPP
@@ -0,0 +1,39 @@
+#ifndef SPAN_INPUT_STREAM_HPP
+#define SPAN_INPUT_STREAM_HPP
+
+#include "interfaces/IInputStream.hpp"
+#include <string_view>
+
+namespace slideEditor::io {
+
+/**
+ * SpanInputStream - Input stream over characters owned by the caller
+ *
+ * Nothing is copied: reset() points the stream at a new span, so one
+ * instance (and a lexer reading it) can be reused for every command line.
+ * The caller keeps the characters alive while the stream reads them.
+ */
+class SpanInputStream : public core::IInputStream {
+public:
+    SpanInputStream() = default;
+    explicit SpanInputStream(std::string_view text);
+    
+    void reset(std::string_view text);
+    
+    std::optional<char> get() override;
+    std::optional<char> peek() override;
+    bool eof() const override;
+    bool good() const override;
+    void unget() override;
+    
+    size_t read(char* buffer, size_t size) override;
+    bool readLine(std::string& line) override;
+
+private:
+    std::string_view text_;
+    size_t position_ = 0;
+};
+
+} // namespace slideEditor::io
+
+#endif // SPAN_INPUT_STREAM_HPP
@@ -1,76 +1,141 @@
 #include "io/InputStream.hpp"
-#include <sstream>
+#include <algorithm>
+#include <cstring>
 
 namespace slideEditor::io {
 
-InputStream::InputStream(std::istream& stream)
-    : stream_(&stream), ownsStream_(false), 
-      lastChar_('\0'), hasUnget_(false) {}
+InputStream::InputStream(std::istream& stream, FillMode mode)
+    : stream_(&stream), mode_(mode),
+      buffer_(std::make_unique<char[]>(BLOCK_SIZE + 1)), capacity_(BLOCK_SIZE + 1),
+      position_(0), end_(0), begin_(0) {}
 
 InputStream::InputStream(const std::string& str)
-    : ownsStream_(true), lastChar_('\0'), hasUnget_(false) {
-    ownedStream_ = std::make_unique<std::istringstream>(str);
-    stream_ = ownedStream_.get();
+    : stream_(nullptr), mode_(FillMode::BLOCK),
+      buffer_(std::make_unique<char[]>(str.size() + 1)), capacity_(str.size() + 1),
+      position_(1), end_(str.size() + 1), begin_(1) {
+    // The whole string is the buffer; slot 0 is the unget slot, as after a refill
+    std::memcpy(buffer_.get() + 1, str.data(), str.size());
 }
 
-InputStream::~InputStream() {
-    // Unique_ptr handles cleanup of owned stream
-}
+InputStream::~InputStream() = default;
 
-std::optional<char> InputStream::get() {
-    if (hasUnget_) {
-        hasUnget_ = false;
-        return lastChar_;
+bool InputStream::ensure() {
+    if (position_ < end_) {
+        return true;
     }
     
-    if (!stream_ || stream_->eof()) {
-        return std::nullopt;
+    if (!stream_) {
+        return false;
     }
     
-    char c;
-    if (stream_->get(c)) {
-        lastChar_ = c;
-        return c;
+    // Keep the last character in slot 0 so unget() still works after a refill
+    if (end_ > begin_) {
+        buffer_[0] = buffer_[end_ - 1];
+        begin_ = 0;
+        position_ = 1;
+    } 
+    else {
+        begin_ = position_;
     }
     
-    return std::nullopt;
-}
-
-std::optional<char> InputStream::peek() {
-    if (hasUnget_) {
-        return lastChar_;
+    std::streambuf* source = stream_->rdbuf();
+    char* target = buffer_.get() + position_;
+    const size_t room = capacity_ - position_;
+    std::streamsize count = 0;
+    if (mode_ == FillMode::BLOCK) {
+        count = source->sgetn(target, static_cast<std::streamsize>(room));
+    } 
+    else if (source->sgetc() != std::char_traits<char>::eof()) {
+        // Waits for one character, then takes whatever else is already buffered
+        const std::streamsize available = std::max<std::streamsize>(source->in_avail(), 1);
+        count = source->sgetn(target, std::min(available, static_cast<std::streamsize>(room)));
     }
     
-    if (!stream_ || stream_->eof()) {
-        return std::nullopt;
+    end_ = position_ + static_cast<size_t>(count);
+    if (count <= 0) {
+        stream_->setstate(std::ios::eofbit);
+        stream_ = nullptr;
+        return false;
     }
     
-    int peeked = stream_->peek();
-    if (peeked == EOF) {
+    return true;
+}
+
+std::optional<char> InputStream::get() {
+    if (!ensure()) {
         return std::nullopt;
     }
     
-    return static_cast<char>(peeked);
+    return buffer_[position_++];
 }
 
-bool InputStream::eof() const {
-    if (hasUnget_) {
-        return false;
+std::optional<char> InputStream::peek() {
+    if (!ensure()) {
+        return std::nullopt;
     }
+    
+    return buffer_[position_];
+}
 
-    return !stream_ || stream_->eof();
+bool InputStream::eof() const {
+    return position_ >= end_ && !stream_;
 }
 
 bool InputStream::good() const {
-    if (hasUnget_) {
-        return true;
+    return !eof();
+}
+
+void InputStream::unget() {
+    if (position_ > begin_) {
+        --position_;
     }
+}
 
-    return stream_ && stream_->good();
+size_t InputStream::read(char* buffer, size_t size) {
+    size_t count = 0;
+    while (count < size && ensure()) {
+        const size_t chunk = std::min(size - count, end_ - position_);
+        std::memcpy(buffer + count, buffer_.get() + position_, chunk);
+        position_ += chunk;
+        count += chunk;
+    }
+    
+    return count;
 }
 
-void InputStream::unget() {
-    hasUnget_ = true;
+bool InputStream::readLine(std::string& line) {
+    line.clear();
+    if (!ensure()) {
+        return false;
+    }
+    
+    do {
+        const char* begin = buffer_.get() + position_;
+        const size_t length = end_ - position_;
+        const auto* newline = static_cast<const char*>(std::memchr(begin, '\n', length));
+        const size_t scan = newline ? static_cast<size_t>(newline - begin) : length;
+        // A lone or CRLF carriage return also ends the line
+        const auto* carriage = static_cast<const char*>(std::memchr(begin, '\r', scan));
+        if (carriage) {
+            line.append(begin, carriage);
+            position_ += static_cast<size_t>(carriage - begin) + 1;
+            if (ensure() && buffer_[position_] == '\n') {
+                ++position_;
+            }
+            return true;
+        }
+        
+        if (newline) {
+            line.append(begin, newline);
+            position_ += scan + 1;
+            return true;
+        }
+        
+        line.append(begin, length);
+        position_ = end_;
+    } while (ensure());
+    
+    return true;  // Last line, without a line break
 }
 
-} // namespace slideEditor::io
\ No newline at end of file
+} // namespace slideEditor::io
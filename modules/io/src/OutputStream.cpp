@@ -4,35 +4,70 @@
 
 namespace slideEditor::io {
 
-OutputStream::OutputStream(std::ostream& stream)
-    : stream_(&stream), ownsStream_(false) {}
+OutputStream::OutputStream(std::ostream& stream, Buffering buffering)
+    : stream_(&stream), ownsStream_(false), buffering_(buffering),
+      verbosity_(core::Verbosity::NORMAL) {
+    if (buffering_ == Buffering::FULL) {
+        pending_.reserve(BUFFER_CAPACITY);
+    }
+}
 
 OutputStream::OutputStream()
-    : ownsStream_(true) {
+    : ownsStream_(true), buffering_(Buffering::NONE), verbosity_(core::Verbosity::NORMAL) {
     ownedStream_ = std::make_unique<std::ostringstream>();
     stream_ = ownedStream_.get();
 }
 
-OutputStream::~OutputStream() {}
+OutputStream::~OutputStream() {
+    if (!pending_.empty()) {
+        flush();
+    }
+}
 
 void OutputStream::write(const std::string& data) {
+    if (buffering_ == Buffering::FULL) {
+        pending_ += data;
+        if (pending_.size() >= BUFFER_CAPACITY) {
+            drain();
+        }
+        return;
+    }
+    
     if (stream_) {
         *stream_ << data;
     }
 }
 
 void OutputStream::writeLine(const std::string& line) {
+    if (buffering_ == Buffering::FULL) {
+        pending_ += line;
+        pending_ += '\n';
+        if (pending_.size() >= BUFFER_CAPACITY) {
+            drain();
+        }
+        return;
+    }
+    
     if (stream_) {
         *stream_ << line << '\n';
     }
 }
 
 void OutputStream::flush() {
+    drain();
     if (stream_) {
         stream_->flush();
     }
 }
 
+// Hands the buffered text to the stream in one write, without flushing it
+void OutputStream::drain() {
+    if (stream_ && !pending_.empty()) {
+        stream_->write(pending_.data(), static_cast<std::streamsize>(pending_.size()));
+    }
+    pending_.clear();
+}
+
 bool OutputStream::good() const {
     return stream_ && stream_->good();
 }
@@ -41,6 +76,14 @@ bool OutputStream::fail() const {
     return !stream_ || stream_->fail();
 }
 
+core::Verbosity OutputStream::getVerbosity() const {
+    return verbosity_;
+}
+
+void OutputStream::setVerbosity(core::Verbosity verbosity) {
+    verbosity_ = verbosity;
+}
+
 std::string OutputStream::getOutput() const {
     if (auto* sstream = dynamic_cast<std::ostringstream*>(stream_)) {
         return sstream->str();
@@ -0,0 +1,77 @@
+#include "io/SpanInputStream.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace slideEditor::io {
+
+SpanInputStream::SpanInputStream(std::string_view text)
+    : text_(text) {}
+
+void SpanInputStream::reset(std::string_view text) {
+    text_ = text;
+    position_ = 0;
+}
+
+std::optional<char> SpanInputStream::get() {
+    if (position_ >= text_.size()) {
+        return std::nullopt;
+    }
+    
+    return text_[position_++];
+}
+
+std::optional<char> SpanInputStream::peek() {
+    if (position_ >= text_.size()) {
+        return std::nullopt;
+    }
+    
+    return text_[position_];
+}
+
+bool SpanInputStream::eof() const {
+    return position_ >= text_.size();
+}
+
+bool SpanInputStream::good() const {
+    return position_ < text_.size();
+}
+
+void SpanInputStream::unget() {
+    if (position_ > 0) {
+        --position_;
+    }
+}
+
+size_t SpanInputStream::read(char* buffer, size_t size) {
+    const size_t count = std::min(size, text_.size() - position_);
+    std::memcpy(buffer, text_.data() + position_, count);
+    position_ += count;
+    return count;
+}
+
+bool SpanInputStream::readLine(std::string& line) {
+    line.clear();
+    if (position_ >= text_.size()) {
+        return false;
+    }
+    
+    const char* begin = text_.data() + position_;
+    const size_t length = text_.size() - position_;
+    const auto* newline = static_cast<const char*>(std::memchr(begin, '\n', length));
+    const size_t scan = newline ? static_cast<size_t>(newline - begin) : length;
+    const auto* carriage = static_cast<const char*>(std::memchr(begin, '\r', scan));
+    if (carriage) {
+        line.assign(begin, carriage);
+        position_ += static_cast<size_t>(carriage - begin) + 1;
+        if (position_ < text_.size() && text_[position_] == '\n') {
+            ++position_;
+        }
+        return true;
+    }
+    
+    line.assign(begin, scan);
+    position_ += newline ? scan + 1 : scan;
+    return true;
+}
+
+} // namespace slideEditor::io
@@ -13,9 +13,10 @@ public:
     Slide(int id, std::string title, std::string content, std::string theme);
     
     int getId() const override;
-    std::string getTitle() const override;
-    std::string getContent() const override;
-    std::string getTheme() const override;
+    void setId(int id) override;
+    const std::string& getTitle() const override;
+    const std::string& getContent() const override;
+    const std::string& getTheme() const override;
     const std::vector<std::unique_ptr<core::IShape>>& getShapes() const override;
     
     void addShape(std::unique_ptr<core::IShape> shape) override;
@@ -23,6 +24,7 @@ public:
     size_t getShapeCount() const override;
     
     std::string serialize() const override;
+    std::uint64_t getVersion() const override;
 
 private:
     int id_;
@@ -30,6 +32,7 @@ private:
     std::string content_;
     std::string theme_;
     std::vector<std::unique_ptr<core::IShape>> shapes_;
+    std::uint64_t version_;
 };
 
 } // namespace slideEditor::model
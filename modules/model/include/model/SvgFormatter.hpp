@@ -0,0 +1,59 @@
+#ifndef SVG_FORMATTER_HPP
+#define SVG_FORMATTER_HPP
+
+#include "model/Color.hpp"
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace slideEditor::model {
+
+struct SvgStyle {
+    Color stroke;
+    Color fill;
+    double strokeWidth;
+    std::string_view className = {};  // When set, elements reference it instead of inline attributes
+};
+
+/**
+ * SvgFormatter - Allocation-free SVG element emitters
+ *
+ * Numbers are written with std::to_chars at a fixed precision of
+ * COORDINATE_PRECISION decimals (trailing zeros trimmed), independent of
+ * the global locale. Every function appends to a caller-owned buffer, so
+ * a reused buffer reaches steady state without further allocations.
+ *
+ * Text is escaped by scanning for XML special characters 16 or 32 bytes at
+ * a time (SSE2/AVX2 when the target has them) and copying clean runs whole.
+ */
+class SvgFormatter {
+public:
+    static constexpr int COORDINATE_PRECISION = 2;
+
+    static void appendNumber(std::string& out, double value);
+    static void appendHexColor(std::string& out, const Color& color);
+    
+    // Appends text with & < > " ' replaced by their entities
+    static void appendEscaped(std::string& out, std::string_view text);
+    // Position of the first special character at or after from, or text.size()
+    static size_t findSpecial(std::string_view text, size_t from = 0);
+
+    // fill="..." stroke="..." stroke-width="..." fill-opacity="...", or class="..." with a className
+    static void appendStyle(std::string& out, const SvgStyle& style);
+    // The same properties as CSS declarations: fill:...;stroke:...;stroke-width:...;fill-opacity:...
+    static void appendStyleRule(std::string& out, const SvgStyle& style);
+
+    static void appendCircle(std::string& out, double cx, double cy, double r,
+                             const SvgStyle& style);
+    static void appendRect(std::string& out, double x, double y, double width, double height,
+                           const SvgStyle& style);
+    // points holds pointCount (x, y) pairs
+    static void appendPolygon(std::string& out, const double* points, size_t pointCount,
+                              const SvgStyle& style);
+    static void appendEllipse(std::string& out, double cx, double cy, double rx, double ry,
+                              const SvgStyle& style);
+};
+
+} // namespace slideEditor::model
+
+#endif // SVG_FORMATTER_HPP
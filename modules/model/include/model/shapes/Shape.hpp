@@ -2,6 +2,7 @@
 #define SHAPE_HPP
 
 #include "interfaces/IShape.hpp"
+#include "model/BoundingBox.hpp"
 #include "model/Color.hpp"
 #include <string>
 #include <memory>
@@ -29,6 +30,9 @@ public:
     std::unique_ptr<core::IShape> clone() const override;
     
     std::string toSVG(double x, double y) const override;
+    void appendSVG(std::string& out, double x, double y) const override;
+    void appendSVG(std::string& out, double x, double y, std::string_view styleClass) const override;
+    void appendStyleRule(std::string& out) const override;
     
     double getCircleRadius() const;
     double getRectangleWidth() const;
@@ -36,6 +40,12 @@ public:
     double getTriangleSide() const;
     double getEllipseRadiusX() const;
     double getEllipseRadiusY() const;
+    
+    // Extent of the geometry drawn by appendSVG at (x, y), stroke excluded
+    BoundingBox getBounds(double x, double y) const;
+    
+    const Color& getBorderColorValue() const;
+    const Color& getFillColorValue() const;
 
 protected:
     core::ShapeType type_;
@@ -43,6 +53,7 @@ protected:
     Color borderColor_;
     Color fillColor_;
     
+    static constexpr double STROKE_WIDTH = 2.0;
     static constexpr double CIRCLE_BASE_RADIUS = 50.0;
     static constexpr double RECTANGLE_BASE_WIDTH = 100.0;
     static constexpr double RECTANGLE_BASE_HEIGHT = 60.0;
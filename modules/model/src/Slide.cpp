@@ -1,25 +1,39 @@
 #include "model/Slide.hpp"
 #include <sstream>
+#include <atomic>
 
 namespace slideEditor::model {
 
+namespace {
+    // Versions are drawn from one process-wide counter so that a (slide id, version)
+    // pair never repeats, even when ids are reused after clear() or load.
+    std::uint64_t nextVersion() {
+        static std::atomic<std::uint64_t> counter{0};
+        return ++counter;
+    }
+}
+
 Slide::Slide(int id, std::string title, std::string content, std::string theme)
     : id_(id), title_(std::move(title)), content_(std::move(content)), 
-      theme_(std::move(theme)) {}
+      theme_(std::move(theme)), version_(nextVersion()) {}
 
 int Slide::getId() const { 
     return id_;
 }
 
-std::string Slide::getTitle() const { 
+void Slide::setId(int id) {
+    id_ = id;
+}
+
+const std::string& Slide::getTitle() const { 
     return title_; 
 }
 
-std::string Slide::getContent() const { 
+const std::string& Slide::getContent() const { 
     return content_; 
 }
 
-std::string Slide::getTheme() const { 
+const std::string& Slide::getTheme() const { 
     return theme_; 
 }
 
@@ -30,12 +44,14 @@ const std::vector<std::unique_ptr<core::IShape>>& Slide::getShapes() const {
 void Slide::addShape(std::unique_ptr<core::IShape> shape) {
     if (shape) {
         shapes_.push_back(std::move(shape));
+        version_ = nextVersion();
     }
 }
 
 bool Slide::removeShape(size_t index) {
     if (index < shapes_.size()) {
         shapes_.erase(shapes_.begin() + index);
+        version_ = nextVersion();
         return true;
     }
 
@@ -63,4 +79,8 @@ std::string Slide::serialize() const {
     return oss.str();
 }
 
+std::uint64_t Slide::getVersion() const {
+    return version_;
+}
+
 } // namespace slideEditor::model
\ No newline at end of file
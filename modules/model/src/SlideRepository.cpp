@@ -8,6 +8,7 @@ int SlideRepository::addSlide(std::unique_ptr<core::ISlide> slide) {
     if (!slide) return -1;
     
     int id = nextId_++;
+    slide->setId(id);
     size_t index = slides_.size();
     idToIndex_[id] = index;
     slides_.push_back(std::move(slide));
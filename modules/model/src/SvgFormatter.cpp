@@ -0,0 +1,231 @@
+#include "model/SvgFormatter.hpp"
+#include <charconv>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace slideEditor::model {
+
+namespace {
+    // '<' 0x3C and '>' 0x3E differ only in bit 1, '&' 0x26 and '\'' 0x27 only in bit 0,
+    // so three compares cover all five characters
+    inline bool isSpecial(char c) {
+        return (c | 0x02) == '>' || (c | 0x01) == '\'' || c == '"';
+    }
+
+    inline std::string_view entityFor(char c) {
+        switch (c) {
+            case '&': return "&amp;";
+            case '<': return "&lt;";
+            case '>': return "&gt;";
+            case '"': return "&quot;";
+            default: return "&apos;";
+        }
+    }
+}
+
+void SvgFormatter::appendNumber(std::string& out, double value) {
+    char buffer[64];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value,
+                                   std::chars_format::fixed, COORDINATE_PRECISION);
+    if (ec != std::errc()) {
+        out += '0';
+        return;
+    }
+
+    // Trim trailing zeros and a dangling decimal point ("12.50" -> "12.5", "3.00" -> "3")
+    char* last = end;
+    for (char* p = buffer; p != end; ++p) {
+        if (*p == '.') {
+            while (last[-1] == '0') {
+                --last;
+            }
+            if (last[-1] == '.') {
+                --last;
+            }
+
+            break;
+        }
+    }
+
+    if (last - buffer == 2 && buffer[0] == '-' && buffer[1] == '0') {
+        out += '0';  // No negative zero
+        return;
+    }
+
+    out.append(buffer, last);
+}
+
+void SvgFormatter::appendHexColor(std::string& out, const Color& color) {
+    static constexpr char digits[] = "0123456789abcdef";
+    char hex[7] = {
+        '#',
+        digits[color.r >> 4], digits[color.r & 0xF],
+        digits[color.g >> 4], digits[color.g & 0xF],
+        digits[color.b >> 4], digits[color.b & 0xF]
+    };
+
+    out.append(hex, sizeof(hex));
+}
+
+size_t SvgFormatter::findSpecial(std::string_view text, size_t from) {
+    const char* data = text.data();
+    const size_t size = text.size();
+    size_t i = from;
+#if defined(__AVX2__)
+    const __m256i angle = _mm256_set1_epi8('>');
+    const __m256i amp = _mm256_set1_epi8('\'');
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i bit1 = _mm256_set1_epi8(0x02);
+    const __m256i bit0 = _mm256_set1_epi8(0x01);
+    for (; i + 32 <= size; i += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i hits = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_or_si256(chunk, bit1), angle),
+                            _mm256_cmpeq_epi8(_mm256_or_si256(chunk, bit0), amp)),
+            _mm256_cmpeq_epi8(chunk, quote));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hits));
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i angle = _mm_set1_epi8('>');
+    const __m128i amp = _mm_set1_epi8('\'');
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i bit1 = _mm_set1_epi8(0x02);
+    const __m128i bit0 = _mm_set1_epi8(0x01);
+    for (; i + 16 <= size; i += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i hits = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(_mm_or_si128(chunk, bit1), angle),
+                         _mm_cmpeq_epi8(_mm_or_si128(chunk, bit0), amp)),
+            _mm_cmpeq_epi8(chunk, quote));
+        int mask = _mm_movemask_epi8(hits);
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        if (isSpecial(data[i])) {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+void SvgFormatter::appendEscaped(std::string& out, std::string_view text) {
+    size_t special = findSpecial(text);
+    if (special == text.size()) {
+        out.append(text);  // Clean text, the common case
+        return;
+    }
+
+    size_t start = 0;
+    while (special < text.size()) {
+        out.append(text.data() + start, special - start);
+        out += entityFor(text[special]);
+        start = special + 1;
+        special = findSpecial(text, start);
+    }
+
+    out.append(text.data() + start, text.size() - start);
+}
+
+void SvgFormatter::appendStyle(std::string& out, const SvgStyle& style) {
+    if (!style.className.empty()) {
+        out += "class=\"";
+        out += style.className;
+        out += '"';
+        return;
+    }
+
+    out += "fill=\"";
+    appendHexColor(out, style.fill);
+    out += "\" stroke=\"";
+    appendHexColor(out, style.stroke);
+    out += "\" stroke-width=\"";
+    appendNumber(out, style.strokeWidth);
+    out += "\" fill-opacity=\"";
+    appendNumber(out, style.fill.getOpacity());
+    out += '"';
+}
+
+void SvgFormatter::appendStyleRule(std::string& out, const SvgStyle& style) {
+    out += "fill:";
+    appendHexColor(out, style.fill);
+    out += ";stroke:";
+    appendHexColor(out, style.stroke);
+    out += ";stroke-width:";
+    appendNumber(out, style.strokeWidth);
+    out += ";fill-opacity:";
+    appendNumber(out, style.fill.getOpacity());
+}
+
+void SvgFormatter::appendCircle(std::string& out, double cx, double cy, double r,
+                                const SvgStyle& style) {
+    out += "<circle cx=\"";
+    appendNumber(out, cx);
+    out += "\" cy=\"";
+    appendNumber(out, cy);
+    out += "\" r=\"";
+    appendNumber(out, r);
+    out += "\" ";
+    appendStyle(out, style);
+    out += " />";
+}
+
+void SvgFormatter::appendRect(std::string& out, double x, double y, double width, double height,
+                              const SvgStyle& style) {
+    out += "<rect x=\"";
+    appendNumber(out, x);
+    out += "\" y=\"";
+    appendNumber(out, y);
+    out += "\" width=\"";
+    appendNumber(out, width);
+    out += "\" height=\"";
+    appendNumber(out, height);
+    out += "\" ";
+    appendStyle(out, style);
+    out += " />";
+}
+
+void SvgFormatter::appendPolygon(std::string& out, const double* points, size_t pointCount,
+                                 const SvgStyle& style) {
+    out += "<polygon points=\"";
+    for (size_t i = 0; i < pointCount; ++i) {
+        if (i > 0) {
+            out += ' ';
+        }
+
+        appendNumber(out, points[2 * i]);
+        out += ',';
+        appendNumber(out, points[2 * i + 1]);
+    }
+
+    out += "\" ";
+    appendStyle(out, style);
+    out += " />";
+}
+
+void SvgFormatter::appendEllipse(std::string& out, double cx, double cy, double rx, double ry,
+                                 const SvgStyle& style) {
+    out += "<ellipse cx=\"";
+    appendNumber(out, cx);
+    out += "\" cy=\"";
+    appendNumber(out, cy);
+    out += "\" rx=\"";
+    appendNumber(out, rx);
+    out += "\" ry=\"";
+    appendNumber(out, ry);
+    out += "\" ";
+    appendStyle(out, style);
+    out += " />";
+}
+
+} // namespace slideEditor::model
@@ -1,4 +1,5 @@
 #include "model/shapes/Shape.hpp"
+#include "model/SvgFormatter.hpp"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
@@ -67,69 +68,51 @@ std::unique_ptr<core::IShape> Shape::clone() const {
 }
 
 std::string Shape::toSVG(double x, double y) const {
-    std::ostringstream svg;
-    std::string fill = fillColor_.toHex();
-    std::string stroke = borderColor_.toHex();
-    double strokeWidth = 2.0;
-    double opacity = fillColor_.getOpacity();
-    switch (type_) {
-        case core::ShapeType::CIRCLE: {
-            double r = getCircleRadius();
-            svg << "<circle cx=\"" << x << "\" cy=\"" << y << "\" r=\"" << r << "\" "
-                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
-                << "stroke-width=\"" << strokeWidth << "\" "
-                << "fill-opacity=\"" << opacity << "\" />";
+    std::string svg;
+    appendSVG(svg, x, y);
+    
+    return svg;
+}
+
+void Shape::appendSVG(std::string& out, double x, double y) const {
+    appendSVG(out, x, y, std::string_view());
+}
 
+void Shape::appendSVG(std::string& out, double x, double y, std::string_view styleClass) const {
+    const SvgStyle style{borderColor_, fillColor_, STROKE_WIDTH, styleClass};
+    switch (type_) {
+        case core::ShapeType::CIRCLE:
+            SvgFormatter::appendCircle(out, x, y, getCircleRadius(), style);
             break;
-        }
         
         case core::ShapeType::RECTANGLE: {
             double w = getRectangleWidth();
             double h = getRectangleHeight();
-            svg << "<rect x=\"" << (x - w/2) << "\" y=\"" << (y - h/2) << "\" "
-                << "width=\"" << w << "\" height=\"" << h << "\" "
-                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
-                << "stroke-width=\"" << strokeWidth << "\" "
-                << "fill-opacity=\"" << opacity << "\" />";
-
+            SvgFormatter::appendRect(out, x - w/2, y - h/2, w, h, style);
             break;
         }
         
         case core::ShapeType::TRIANGLE: {
             double side = getTriangleSide();
             double height = side * std::sqrt(3.0) / 2.0;
-            double x1 = x;
-            double y1 = y - height * 2.0 / 3.0;
-            double x2 = x - side / 2.0;
-            double y2 = y + height / 3.0;
-            double x3 = x + side / 2.0;
-            double y3 = y + height / 3.0;
+            const double points[] = {
+                x, y - height * 2.0 / 3.0,
+                x - side / 2.0, y + height / 3.0,
+                x + side / 2.0, y + height / 3.0
+            };
             
-            svg << "<polygon points=\"" 
-                << x1 << "," << y1 << " "
-                << x2 << "," << y2 << " "
-                << x3 << "," << y3 << "\" "
-                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
-                << "stroke-width=\"" << strokeWidth << "\" "
-                << "fill-opacity=\"" << opacity << "\" />";
-
+            SvgFormatter::appendPolygon(out, points, 3, style);
             break;
         }
         
-        case core::ShapeType::ELLIPSE: {
-            double rx = getEllipseRadiusX();
-            double ry = getEllipseRadiusY();
-            svg << "<ellipse cx=\"" << x << "\" cy=\"" << y << "\" "
-                << "rx=\"" << rx << "\" ry=\"" << ry << "\" "
-                << "fill=\"" << fill << "\" stroke=\"" << stroke << "\" "
-                << "stroke-width=\"" << strokeWidth << "\" "
-                << "fill-opacity=\"" << opacity << "\" />";
-                
+        case core::ShapeType::ELLIPSE:
+            SvgFormatter::appendEllipse(out, x, y, getEllipseRadiusX(), getEllipseRadiusY(), style);
             break;
-        }
     }
-    
-    return svg.str();
+}
+
+void Shape::appendStyleRule(std::string& out) const {
+    SvgFormatter::appendStyleRule(out, SvgStyle{borderColor_, fillColor_, STROKE_WIDTH});
 }
 
 double Shape::getCircleRadius() const {
@@ -156,4 +139,42 @@ double Shape::getEllipseRadiusY() const {
     return ELLIPSE_BASE_RADIUS_Y * scale_;
 }
 
-} // namespace slideEditor::model
\ No newline at end of file
+BoundingBox Shape::getBounds(double x, double y) const {
+    switch (type_) {
+        case core::ShapeType::CIRCLE: {
+            double r = getCircleRadius();
+            return BoundingBox(x - r, y - r, 2 * r, 2 * r);
+        }
+        
+        case core::ShapeType::RECTANGLE: {
+            double w = getRectangleWidth();
+            double h = getRectangleHeight();
+            return BoundingBox(x - w/2, y - h/2, w, h);
+        }
+        
+        case core::ShapeType::TRIANGLE: {
+            // Centroid at (x, y), apex up, as in appendSVG
+            double side = getTriangleSide();
+            double height = side * std::sqrt(3.0) / 2.0;
+            return BoundingBox(x - side / 2.0, y - height * 2.0 / 3.0, side, height);
+        }
+        
+        case core::ShapeType::ELLIPSE: {
+            double rx = getEllipseRadiusX();
+            double ry = getEllipseRadiusY();
+            return BoundingBox(x - rx, y - ry, 2 * rx, 2 * ry);
+        }
+    }
+    
+    return BoundingBox(x, y);
+}
+
+const Color& Shape::getBorderColorValue() const {
+    return borderColor_;
+}
+
+const Color& Shape::getFillColorValue() const {
+    return fillColor_;
+}
+
+} // namespace slideEditor::model
@@ -0,0 +1,79 @@
+#ifndef LAYOUT_ENGINE_HPP
+#define LAYOUT_ENGINE_HPP
+
+#include "interfaces/ISlide.hpp"
+#include "model/BoundingBox.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace slideEditor::view {
+
+enum class LayoutMode {
+    GRID,    // Fixed SlideLayout grid; large shapes may overlap their neighbours
+    PACKED   // Rows sized to the shapes they hold, so no two shapes overlap;
+             // shrunk together when the rows would not fit the slide
+};
+
+// Where one shape sits, in slide-local coordinates (slide top at y = 0)
+struct ShapePlacement {
+    double x;                    // Position passed to IShape::appendSVG
+    double y;
+    model::BoundingBox bounds;   // Drawn extent, stroke excluded
+    double scale = 1.0;          // Applied around (x, y); below 1 only when packing shrank
+};
+
+/**
+ * LayoutEngine - Computes and caches shape placements per slide
+ *
+ * Placements are computed once per (slide id, version, mode) and reused until
+ * the slide mutates, which bumps its version. Renderers add the slide's
+ * vertical offset; hit-testing and overlap queries read the same placements,
+ * so they always agree with what was drawn. Not thread-safe: give each
+ * rendering thread its own engine.
+ */
+class LayoutEngine {
+public:
+    static constexpr double PACK_GAP = 10.0;  // Space between packed shapes and rows
+
+    LayoutEngine() = default;
+
+    // Valid until the next layout() call for the same slide
+    const std::vector<ShapePlacement>& layout(const core::ISlide* slide,
+                                              LayoutMode mode = LayoutMode::GRID);
+
+    // Index of the topmost (last drawn) shape containing the slide-local point, or -1
+    int hitTest(const core::ISlide* slide, double x, double y,
+                LayoutMode mode = LayoutMode::GRID);
+    // Index pairs (i < j) of shapes whose bounds intersect
+    std::vector<std::pair<size_t, size_t>> findOverlaps(const core::ISlide* slide,
+                                                        LayoutMode mode = LayoutMode::GRID);
+
+    // Drops placements of slides not laid out since the previous prune
+    void prune();
+    void clear();
+    size_t getEntryCount() const;
+    size_t getHitCount() const;
+    size_t getMissCount() const;
+
+    static void computeGrid(const core::ISlide* slide, std::vector<ShapePlacement>& placements);
+    static void computePacked(const core::ISlide* slide, std::vector<ShapePlacement>& placements);
+
+private:
+    struct Entry {
+        std::uint64_t version = 0;
+        LayoutMode mode = LayoutMode::GRID;
+        size_t pass = 0;  // Last prune period the entry was used in
+        std::vector<ShapePlacement> placements;
+    };
+
+    std::unordered_map<int, Entry> entries_;  // By slide id
+    size_t pass_ = 0;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
+} // namespace slideEditor::view
+
+#endif // LAYOUT_ENGINE_HPP
@@ -0,0 +1,76 @@
+#ifndef PREVIEW_SERVER_HPP
+#define PREVIEW_SERVER_HPP
+
+#include "interfaces/ISlideRepository.hpp"
+#include "view/SvgRenderer.hpp"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace slideEditor::view {
+
+/**
+ * PreviewServer - Localhost HTTP server for a live view of the deck
+ *
+ * GET / serves a page holding one inline <svg> per slide; the page opens
+ * GET /events as a Server-Sent Events stream. publish() compares each slide's
+ * (id, version) with what was pushed last and sends only the fragments that
+ * changed, so the open page updates in place without reloading the deck.
+ * A new stream first receives a snapshot of the whole deck. Requests are
+ * served on a background thread; sockets are POSIX only, so start() fails
+ * on other platforms.
+ */
+class PreviewServer {
+public:
+    static constexpr int DEFAULT_PORT = 8080;
+
+    PreviewServer();
+    ~PreviewServer();
+
+    PreviewServer(const PreviewServer&) = delete;
+    PreviewServer& operator=(const PreviewServer&) = delete;
+
+    // Listens on 127.0.0.1; port 0 picks a free port
+    bool start(int port = DEFAULT_PORT);
+    void stop();
+    bool isRunning() const;
+    int getPort() const;
+    std::string getUrl() const;
+
+    // Pushes slides changed since the last publish; returns how many were sent
+    size_t publish(const core::ISlideRepository* repository);
+    size_t getClientCount() const;
+
+    static std::string pageHtml();
+
+private:
+    void serve();
+    void handleConnection(int fd);
+    void broadcast(const std::string& events);  // Caller holds mutex_
+    void appendSnapshot(std::string& out) const;
+
+    static void appendDeckEvent(std::string& out, size_t slideCount);
+    static void appendSlideEvent(std::string& out, size_t index, const std::string& fragment);
+    static bool sendAll(int fd, const char* data, size_t size, bool wait);
+
+    mutable std::mutex mutex_;
+    std::vector<std::pair<int, std::uint64_t>> published_;  // (id, version) per position
+    std::vector<std::string> fragments_;                     // Slide fragments at offset 0
+    std::vector<int> clients_;                               // Open event streams
+    SvgRenderer renderer_;
+    std::string events_;
+
+    std::thread thread_;
+    std::atomic<bool> running_;
+    int listenFd_;
+    int wakeFds_[2];  // Self-pipe that interrupts poll() on stop
+    int port_;
+};
+
+} // namespace slideEditor::view
+
+#endif // PREVIEW_SERVER_HPP
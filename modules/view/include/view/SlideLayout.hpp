@@ -0,0 +1,43 @@
+#ifndef SLIDE_LAYOUT_HPP
+#define SLIDE_LAYOUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+namespace slideEditor::view {
+
+/**
+ * SlideLayout - Page geometry shared by the SVG and raster back ends
+ *
+ * Slides are stacked vertically, SLIDE_HEIGHT + SLIDE_GAP apart; shapes
+ * sit on a grid of at most SHAPES_PER_ROW columns inside each slide.
+ */
+struct SlideLayout {
+    static constexpr int SLIDE_WIDTH = 800;
+    static constexpr int SLIDE_HEIGHT = 600;
+    static constexpr int SLIDE_GAP = 50;
+    static constexpr int SLIDE_PITCH = SLIDE_HEIGHT + SLIDE_GAP;
+    static constexpr int SHAPE_SPACING_X = 120;
+    static constexpr int SHAPE_SPACING_Y = 120;
+    static constexpr int START_X = 100;
+    static constexpr int START_Y = 150;
+    static constexpr int SHAPES_PER_ROW = 5;
+
+    static constexpr int slideOffsetY(int slideNumber) {
+        return slideNumber * SLIDE_PITCH;
+    }
+
+    // Center of shape `index` out of `shapeCount` on the given slide
+    static void shapeCenter(size_t index, size_t shapeCount, int slideNumber,
+                            double& x, double& y) {
+        int shapesPerRow = std::min(SHAPES_PER_ROW, static_cast<int>(shapeCount));
+        int row = static_cast<int>(index) / shapesPerRow;
+        int col = static_cast<int>(index) % shapesPerRow;
+        x = START_X + col * SHAPE_SPACING_X;
+        y = slideOffsetY(slideNumber) + START_Y + row * SHAPE_SPACING_Y;
+    }
+};
+
+} // namespace slideEditor::view
+
+#endif // SLIDE_LAYOUT_HPP
@@ -0,0 +1,57 @@
+#ifndef SPLIT_EXPORTER_HPP
+#define SPLIT_EXPORTER_HPP
+
+#include "interfaces/ISlideRepository.hpp"
+#include "view/SvgGenerator.hpp"
+#include "view/WorkStealingPool.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace slideEditor::view {
+
+struct SplitExportStats {
+    size_t written = 0;    // Slide files (re)generated
+    size_t unchanged = 0;  // Skipped, identical to the previous export
+    size_t removed = 0;    // Files of slides no longer in the deck
+};
+
+/**
+ * SplitExporter - One standalone SVG per slide plus an index.html
+ *
+ * Remembers, per output directory, the version of every slide file it
+ * wrote. A re-export regenerates only slides whose version changed (or
+ * whose file went missing) and deletes files of removed slides; changed
+ * files are generated and written concurrently on a WorkStealingPool.
+ */
+class SplitExporter {
+public:
+    SplitExporter() = default;
+    
+    // Creates directory if needed; pool defaults to WorkStealingPool::shared()
+    bool exportSlides(const core::ISlideRepository* repository, const std::string& directory,
+                      const SvgOptions& options, SplitExportStats& stats,
+                      WorkStealingPool* pool = nullptr);
+    
+    // Forgets previous exports, so the next one rewrites every file
+    void reset();
+    
+    static std::string slideFilename(int slideId);  // slide-<id>.svg
+    static std::string generateIndex(const std::vector<int>& slideIds);
+    
+    static constexpr const char* INDEX_FILENAME = "index.html";
+
+private:
+    struct DirectoryState {
+        std::unordered_map<int, std::uint64_t> versions;  // Slide id -> version on disk
+        SvgOptions options;
+        std::string index;
+    };
+    
+    std::unordered_map<std::string, DirectoryState> directories_;
+};
+
+} // namespace slideEditor::view
+
+#endif // SPLIT_EXPORTER_HPP
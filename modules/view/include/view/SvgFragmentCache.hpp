@@ -0,0 +1,70 @@
+#ifndef SVG_FRAGMENT_CACHE_HPP
+#define SVG_FRAGMENT_CACHE_HPP
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace slideEditor::view {
+
+/**
+ * SvgFragmentCache - Keeps rendered per-slide SVG fragments between draws
+ *
+ * Entries are keyed by slide id, slide content version and the slide's
+ * position in the deck (the fragment embeds its y-offset). A slide mutation
+ * bumps its version, so the old entry is never hit again and ages out
+ * through LRU eviction once the memory budget is exceeded.
+ */
+class SvgFragmentCache {
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 16 * 1024 * 1024;
+
+    explicit SvgFragmentCache(size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+    // Returns the cached fragment or nullptr on miss
+    const std::string* find(int slideId, std::uint64_t version, int slideNumber);
+    void store(int slideId, std::uint64_t version, int slideNumber, std::string fragment);
+    void clear();
+
+    void setMemoryBudget(size_t bytes);
+    size_t getMemoryBudget() const;
+    size_t getMemoryUsage() const;
+    size_t getEntryCount() const;
+    size_t getHitCount() const;
+    size_t getMissCount() const;
+
+private:
+    struct Key {
+        int slideId;
+        std::uint64_t version;
+        int slideNumber;
+
+        bool operator==(const Key& other) const {
+            return slideId == other.slideId && version == other.version &&
+                   slideNumber == other.slideNumber;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key key;
+        std::string fragment;
+    };
+
+    std::list<Entry> entries_;  // Most recently used at front
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+    size_t memoryBudget_;
+    size_t memoryUsage_;
+    size_t hits_;
+    size_t misses_;
+
+    void evictUntilFits(size_t incoming);
+};
+
+} // namespace slideEditor::view
+
+#endif // SVG_FRAGMENT_CACHE_HPP
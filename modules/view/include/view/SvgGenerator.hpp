@@ -2,34 +2,74 @@
 #define SVG_GENERATOR_HPP
 
 #include "interfaces/ISlideRepository.hpp"
+#include "view/LayoutEngine.hpp"
+#include "view/SvgFragmentCache.hpp"
+#include "view/SlideLayout.hpp"
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace slideEditor::view {
 
+struct SvgOptions {
+    // Emit each distinct shape once in <defs> and place instances with <use>
+    bool shapeDefs = false;
+    // Emit each distinct shape style once as a <style> class and reference it with class=
+    bool styleClasses = false;
+    // Shape placement; PACKED keeps shapes larger than the grid spacing from overlapping
+    LayoutMode layout = LayoutMode::GRID;
+    
+    bool operator==(const SvgOptions& other) const {
+        return shapeDefs == other.shapeDefs && styleClasses == other.styleClasses &&
+               layout == other.layout;
+    }
+    bool operator!=(const SvgOptions& other) const {
+        return !(*this == other);
+    }
+};
+
+// Stateless entry points; each call renders on a fresh SvgRenderer
 class SvgGenerator {
 public:
     SvgGenerator() = default;
     
-    std::string generateSVG(const core::ISlideRepository* repository) const; // generate for all slides
+    // Generate for all slides; with a cache, only slides changed since the last call are re-rendered
+    // (the cache is bypassed with shapeDefs or styleClasses, whose ids depend on the whole document,
+    // and with packed layout, as cached fragments do not record the layout they were drawn with)
+    static std::string generateSVG(const core::ISlideRepository* repository,
+                                   SvgFragmentCache* cache = nullptr,
+                                   const SvgOptions& options = SvgOptions());
+    
+    // Generate only slides [first, last) of the deck, laid out as a standalone document;
+    // work is proportional to the range, not the deck size
+    static std::string generateRangeSVG(const core::ISlideRepository* repository,
+                                        size_t first, size_t last,
+                                        SvgFragmentCache* cache = nullptr,
+                                        const SvgOptions& options = SvgOptions());
     
     // Generate SVG for a single slide
-    std::string generateSlideSVG(const core::ISlide* slide, int slideNumber) const;
+    static std::string generateSlideSVG(const core::ISlide* slide, int slideNumber);
     
     // Save SVG to file
-    bool saveToFile(const std::string& svgContent, const std::string& filename) const;
+    static bool saveToFile(const std::string& svgContent, const std::string& filename);
+    static bool saveToFile(const core::ISlideRepository* repository, const std::string& filename,
+                           SvgFragmentCache* cache = nullptr,
+                           const SvgOptions& options = SvgOptions());
     
     // Generate and save
-    bool generateAndSave(const core::ISlideRepository* repository, 
-                        const std::string& filename) const;
-
-private:
-    static constexpr int SVG_WIDTH = 800;
-    static constexpr int SVG_HEIGHT = 600;
-    static constexpr int SHAPE_SPACING_X = 120;
-    static constexpr int SHAPE_SPACING_Y = 120;
-    static constexpr int START_X = 100;
-    static constexpr int START_Y = 150;
+    static bool generateAndSave(const core::ISlideRepository* repository, 
+                                const std::string& filename,
+                                SvgFragmentCache* cache = nullptr,
+                                const SvgOptions& options = SvgOptions());
+    static bool generateAndSaveRange(const core::ISlideRepository* repository,
+                                     const std::string& filename,
+                                     size_t first, size_t last,
+                                     SvgFragmentCache* cache = nullptr,
+                                     const SvgOptions& options = SvgOptions());
+    
+    // Parses an output mode name ("plain", "defs", "classes", "compact" = defs + classes) into options;
+    // "grid" and "packed" select the shape layout and leave the markup mode as it was
+    static bool parseMode(const std::string& mode, SvgOptions& options);
 };
 
 } // namespace slideEditor::view
@@ -0,0 +1,105 @@
+#ifndef SVG_RENDERER_HPP
+#define SVG_RENDERER_HPP
+
+#include "interfaces/ISlideRepository.hpp"
+#include "view/LayoutEngine.hpp"
+#include "view/SvgFragmentCache.hpp"
+#include "view/SvgGenerator.hpp"
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace slideEditor::view {
+
+/**
+ * SvgRenderer - Long-lived SVG renderer that reuses its buffers
+ *
+ * The document, per-slide fragments and element scratch are kept between
+ * calls and only grow (geometrically) when a larger deck needs more room.
+ * Distinct shape and style markup is interned in tables that survive across
+ * draws, so once a deck has been rendered, drawing it again performs no
+ * heap allocations (cache misses still copy fragments into the cache).
+ * The tables are reset when they grow well past the last document, and
+ * placements of slides missing from a draw are dropped.
+ * Shape placements come from the renderer's LayoutEngine, so an unchanged
+ * slide is laid out once. SvgGenerator's static functions run on a
+ * temporary renderer.
+ */
+class SvgRenderer {
+public:
+    SvgRenderer() = default;
+
+    // Renders slides [first, last) as a standalone document; valid until the next render
+    const std::string& render(const core::ISlideRepository* repository,
+                              size_t first, size_t last,
+                              SvgFragmentCache* cache = nullptr,
+                              const SvgOptions& options = SvgOptions());
+    bool renderToFile(const core::ISlideRepository* repository, const std::string& filename,
+                      size_t first, size_t last,
+                      SvgFragmentCache* cache = nullptr,
+                      const SvgOptions& options = SvgOptions());
+
+    // One slide group at deck position slideNumber; valid until the next call
+    const std::string& renderSlide(const core::ISlide* slide, int slideNumber,
+                                   LayoutMode layout = LayoutMode::GRID);
+
+    // Placements used for the last drawing of each slide, for hit-testing
+    LayoutEngine& getLayoutEngine();
+
+    // Moves the last document out, leaving the output buffer empty
+    std::string takeOutput();
+    // Frees every buffer and interned table
+    void release();
+
+    size_t getDrawCount() const;
+    size_t getOutputHighWater() const;   // Largest document produced, in bytes
+    size_t getScratchHighWater() const;  // Largest fragment/markup scratch used, in bytes
+    size_t getReservedBytes() const;     // Capacity currently held by all string buffers
+    size_t getInternedCount() const;     // Style and def markup strings held across draws
+
+private:
+    static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+    // Markup -> intern id, kept across draws; doc* map intern ids to ids in the current document
+    struct InternTable {
+        std::unordered_map<std::string, size_t> ids;
+        std::vector<size_t> docIds;
+        std::vector<size_t> shapeIds;  // Document id of every shape, in deck order
+        std::string markup;            // <style> or <defs> block of the current document
+        size_t docCount = 0;
+
+        void beginDocument();
+        size_t intern(const std::string& key, bool& firstInDocument);
+    };
+
+    void collectStyleClasses(const std::vector<std::unique_ptr<core::ISlide>>& slides,
+                             size_t first, size_t last);
+    void collectShapeDefs(const std::vector<std::unique_ptr<core::ISlide>>& slides,
+                          size_t first, size_t last, bool styleClasses);
+    void appendSlide(std::string& out, const core::ISlide* slide, int slideNumber,
+                     bool shapeDefs, bool styleClasses, LayoutMode layout,
+                     size_t& shapeCursor);
+    void noteScratch(const std::string& buffer);
+
+    static void reserveFor(std::string& buffer, size_t needed);
+    static std::string_view className(char (&buffer)[24], size_t id);
+    static void appendTransform(std::string& out, double x, double y, double scale);
+
+    std::string output_;
+    std::string fragment_;  // Slide group, for the fragment cache and renderSlide
+    std::string key_;       // Intern lookup key
+    InternTable styles_;
+    InternTable defs_;
+    LayoutEngine layout_;
+
+    size_t draws_ = 0;
+    size_t outputHighWater_ = 0;
+    size_t scratchHighWater_ = 0;
+    size_t bytesPerSlide_ = 0;  // From the last draw, to size the next one up front
+};
+
+} // namespace slideEditor::view
+
+#endif // SVG_RENDERER_HPP
@@ -0,0 +1,77 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace slideEditor::view {
+
+/**
+ * WorkStealingPool - Fixed set of workers with one task deque each
+ *
+ * parallelFor deals indices out to the workers' deques in contiguous
+ * chunks; a worker pops from the back of its own deque and, when that is
+ * empty, steals from the front of the others. The calling thread helps
+ * until its batch is done, so nested calls cannot starve. The first
+ * exception thrown by a task is rethrown from parallelFor.
+ */
+class WorkStealingPool {
+public:
+    // threadCount 0 uses std::thread::hardware_concurrency()
+    explicit WorkStealingPool(size_t threadCount = 0);
+    ~WorkStealingPool();
+    
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+    
+    size_t getThreadCount() const;
+    
+    // Runs task(i) for every i in [0, count) and waits for all of them
+    void parallelFor(size_t count, const std::function<void(size_t)>& task);
+    
+    // Process-wide pool, created on first use
+    static WorkStealingPool& shared();
+
+private:
+    struct Batch {
+        const std::function<void(size_t)>* task;
+        std::atomic<size_t> remaining;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+    
+    struct Item {
+        Batch* batch;
+        size_t index;
+    };
+    
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Item> items;
+    };
+    
+    void workerLoop(size_t self);
+    bool popOrSteal(size_t self, Item& item);
+    void run(const Item& item);
+    
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> queued_;
+    std::atomic<size_t> nextQueue_;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;       // Workers: items were queued or shutting down
+    std::condition_variable finished_;   // Callers: some batch completed
+    bool stopping_;
+};
+
+} // namespace slideEditor::view
+
+#endif // WORK_STEALING_POOL_HPP
@@ -3,22 +3,30 @@
 
 #include "interfaces/IView.hpp"
 #include "interfaces/ISlideRepository.hpp"
+#include "interfaces/IOutputStream.hpp"
 #include <iostream>
+#include <memory>
 
 namespace slideEditor::view {
 
 class CliView : public core::IView {
 public:
+    // Flushes after every message
     explicit CliView(std::ostream& output = std::cout);
+    // Buffered: flushes only at the prompt, after errors and on flush(). Share the
+    // stream with the controller's command output so both keep their order.
+    explicit CliView(std::shared_ptr<core::IOutputStream> output);
     
     void displayMessage(const std::string& message) override;
     void displayError(const std::string& error) override;
     void displaySlides(const core::ISlideRepository* repository) override;
     void displayHelp(const std::string& helpText) override;
     void displayPrompt() override;
+    void flush() override;
 
 private:
-    std::ostream& output_;
+    std::shared_ptr<core::IOutputStream> output_;
+    bool buffered_;
     
     // Formatting helpers
     std::string formatSlide(const core::ISlide* slide) const;
@@ -27,4 +35,4 @@ private:
 
 } // namespace
 
-#endif // CLI_VIEW_HPP
\ No newline at end of file
+#endif // CLI_VIEW_HPP
@@ -0,0 +1,80 @@
+#ifndef IMAGE_WRITER_HPP
+#define IMAGE_WRITER_HPP
+
+#include "view/raster/RasterCanvas.hpp"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace slideEditor::view {
+
+enum class ImageFormat {
+    PPM,
+    PNG
+};
+
+/**
+ * ImageWriter - Streaming PPM / PNG encoder without external dependencies
+ *
+ * Rows are appended top to bottom in bands of any height, so an image
+ * never has to exist in memory all at once. PNG output uses the Up filter
+ * and a single fixed-Huffman deflate stream whose only matches are byte
+ * runs (distance 1); flat slide backgrounds collapse to a few bits per
+ * row while the encoder stays a few dozen lines.
+ */
+class ImageWriter {
+public:
+    ImageWriter() = default;
+    ~ImageWriter();
+    
+    ImageWriter(const ImageWriter&) = delete;
+    ImageWriter& operator=(const ImageWriter&) = delete;
+    
+    bool open(const std::string& filename, ImageFormat format, int width, int height);
+    // Appends every row of canvas; its width must match the image
+    bool writeRows(const RasterCanvas& canvas);
+    bool writeRows(const std::uint32_t* pixels, int rowCount);
+    // False if the stream failed or fewer rows than the image height were written
+    bool close();
+    
+    static bool save(const RasterCanvas& canvas, const std::string& filename, ImageFormat format);
+    
+    // "png" / "ppm", case-insensitive
+    static bool parseFormat(const std::string& name, ImageFormat& format);
+    static const char* extension(ImageFormat format);
+    
+    static std::uint32_t crc32(const unsigned char* data, size_t length, std::uint32_t crc = 0);
+
+private:
+    void writeRowPNG(const std::uint32_t* pixels);
+    void writeChunk(const char* type, const unsigned char* data, size_t length);
+    void flushIdat(bool force);
+    
+    // Deflate bit stream
+    void putBits(std::uint32_t bits, int count);
+    void putSymbol(int symbol);
+    void putBytes(const unsigned char* data, size_t length);
+    void flushRun();
+    
+    std::ofstream file_;
+    ImageFormat format_ = ImageFormat::PNG;
+    int width_ = 0;
+    int height_ = 0;
+    int rowsWritten_ = 0;
+    bool open_ = false;
+    
+    std::vector<unsigned char> line_;       // Current row, RGB (PNG: filter byte first)
+    std::vector<unsigned char> previous_;   // Previous row, RGB
+    std::vector<unsigned char> idat_;       // Compressed bytes awaiting an IDAT chunk
+    std::uint64_t bitBuffer_ = 0;
+    int bitCount_ = 0;
+    int lastByte_ = -1;                     // Last byte emitted, for run matches
+    std::uint64_t runLength_ = 0;           // Pending repeats of lastByte_
+    std::uint32_t adlerA_ = 1;
+    std::uint32_t adlerB_ = 0;
+};
+
+} // namespace slideEditor::view
+
+#endif // IMAGE_WRITER_HPP
@@ -0,0 +1,76 @@
+#ifndef RASTER_CANVAS_HPP
+#define RASTER_CANVAS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace slideEditor::view {
+
+/**
+ * RasterCanvas - 8-bit RGBA pixel buffer with vectorized span kernels
+ *
+ * Pixels are packed as r | g << 8 | b << 16 | a << 24. A canvas may cover
+ * a window of a larger image: (originX, originY) is the global coordinate
+ * of its top-left pixel, so renderers can address pixels globally while
+ * the canvas only stores its own region. view() makes a non-owning
+ * canvas over a rectangle of another one, which lets tiles draw straight
+ * into a shared band.
+ */
+class RasterCanvas {
+public:
+    RasterCanvas(int width, int height, int originX = 0, int originY = 0);
+    RasterCanvas(const RasterCanvas& other);
+    RasterCanvas(RasterCanvas&& other) noexcept;
+    RasterCanvas& operator=(const RasterCanvas& other);
+    RasterCanvas& operator=(RasterCanvas&& other) noexcept;
+    
+    // Window of width x height at local (x, y) of target; target must outlive it
+    static RasterCanvas view(RasterCanvas& target, int x, int y, int width, int height);
+    
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    int getOriginX() const { return originX_; }
+    int getOriginY() const { return originY_; }
+    void setOrigin(int originX, int originY) { originX_ = originX; originY_ = originY; }
+    
+    // Local coordinates: 0 <= x < width, 0 <= y < height
+    std::uint32_t* row(int y) { return data_ + static_cast<size_t>(y) * stride_; }
+    const std::uint32_t* row(int y) const { return data_ + static_cast<size_t>(y) * stride_; }
+    std::uint32_t getPixel(int x, int y) const { return row(y)[x]; }
+    // Owned storage, row-major with no padding; empty for views
+    const std::vector<std::uint32_t>& getPixels() const { return pixels_; }
+    bool isView() const { return view_; }
+    
+    void clear(std::uint32_t color);
+    
+    // Spans cover [x0, x1) of local row y
+    void fillSpan(int y, int x0, int x1, std::uint32_t color);
+    void blendSpan(int y, int x0, int x1, std::uint32_t color, std::uint8_t alpha);
+    void blendPixel(int x, int y, std::uint32_t color, std::uint8_t alpha);
+    
+    static constexpr std::uint32_t packColor(std::uint8_t r, std::uint8_t g, std::uint8_t b,
+                                             std::uint8_t a = 255) {
+        return static_cast<std::uint32_t>(r) | (static_cast<std::uint32_t>(g) << 8) |
+               (static_cast<std::uint32_t>(b) << 16) | (static_cast<std::uint32_t>(a) << 24);
+    }
+    
+    static constexpr std::uint8_t red(std::uint32_t c) { return c & 0xFF; }
+    static constexpr std::uint8_t green(std::uint32_t c) { return (c >> 8) & 0xFF; }
+    static constexpr std::uint8_t blue(std::uint32_t c) { return (c >> 16) & 0xFF; }
+    static constexpr std::uint8_t alpha(std::uint32_t c) { return c >> 24; }
+
+private:
+    int width_;
+    int height_;
+    int originX_;
+    int originY_;
+    int stride_;
+    bool view_;
+    std::vector<std::uint32_t> pixels_;
+    std::uint32_t* data_;
+};
+
+} // namespace slideEditor::view
+
+#endif // RASTER_CANVAS_HPP
@@ -0,0 +1,48 @@
+#ifndef RASTER_RENDERER_HPP
+#define RASTER_RENDERER_HPP
+
+#include "interfaces/ISlideRepository.hpp"
+#include "view/LayoutEngine.hpp"
+#include "view/raster/RasterCanvas.hpp"
+#include "view/raster/Rasterizer.hpp"
+#include "view/raster/ImageWriter.hpp"
+#include "view/WorkStealingPool.hpp"
+#include <string>
+#include <vector>
+
+namespace slideEditor::view {
+
+/**
+ * RasterRenderer - Draws slides to pixels using the SVG page layout
+ *
+ * Slide frames and shapes are rasterized; text is not (there is no font
+ * renderer), so titles and content only appear in SVG output.
+ */
+class RasterRenderer {
+public:
+    // Scene for slides [first, last), positioned as in a document holding only that range;
+    // shapes are placed by the same LayoutEngine pass the SVG renderer uses
+    static std::vector<RasterShape> buildScene(const core::ISlideRepository* repository,
+                                               size_t first, size_t last,
+                                               LayoutMode layout = LayoutMode::GRID);
+    
+    // Canvas size for a range of slideCount slides (an empty range gets one blank page)
+    static int canvasWidth();
+    static int canvasHeight(size_t slideCount);
+    
+    static RasterCanvas render(const core::ISlideRepository* repository, size_t first, size_t last,
+                               LayoutMode layout = LayoutMode::GRID);
+    static void drawScene(RasterCanvas& canvas, const std::vector<RasterShape>& scene);
+    
+    // Tiled on pool (the shared pool if null) and streamed, so any deck size fits in memory
+    static bool renderToFile(const core::ISlideRepository* repository, const std::string& filename,
+                             ImageFormat format, size_t first, size_t last,
+                             LayoutMode layout = LayoutMode::GRID,
+                             WorkStealingPool* pool = nullptr);
+    
+    static constexpr std::uint32_t BACKGROUND = RasterCanvas::packColor(0xf5, 0xf5, 0xf5);
+};
+
+} // namespace slideEditor::view
+
+#endif // RASTER_RENDERER_HPP
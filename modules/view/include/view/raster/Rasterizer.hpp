@@ -0,0 +1,58 @@
+#ifndef RASTERIZER_HPP
+#define RASTERIZER_HPP
+
+#include "interfaces/IShape.hpp"
+#include "view/raster/RasterCanvas.hpp"
+#include <cstdint>
+
+namespace slideEditor::view {
+
+// A shape resolved to canvas geometry
+struct RasterShape {
+    core::ShapeType type;
+    double cx;           // Center (triangle: centroid)
+    double cy;
+    double rx;           // Radius / half width; triangle: half side
+    double ry;           // Radius / half height; triangle: height
+    std::uint32_t fill;
+    std::uint32_t stroke;
+    double strokeWidth;
+};
+
+struct RasterBounds {
+    double left;
+    double top;
+    double right;
+    double bottom;
+};
+
+/**
+ * Rasterizer - Anti-aliased scanline fill and stroke of RasterShapes
+ *
+ * Each row is split into an interior run, where the fill is known to cover
+ * whole pixels and is written with RasterCanvas span kernels, and edge
+ * pixels, whose fill and stroke coverage come from the shape's signed
+ * distance. Both runs come from the shape's analytic row extents, so
+ * per-pixel work is proportional to the perimeter rather than the area. Coordinates are global; only pixels inside the canvas window
+ * are touched.
+ */
+class Rasterizer {
+public:
+    static void draw(RasterCanvas& canvas, const RasterShape& shape);
+    
+    // Extent of every pixel the shape can touch, stroke and anti-aliasing included
+    static RasterBounds bounds(const RasterShape& shape);
+    
+    // Negative inside, positive outside (exact for circles and rectangles)
+    static double signedDistance(const RasterShape& shape, double x, double y);
+
+private:
+    // Horizontal extent of the shape on the line at y; false if the line misses it
+    static bool rowInterval(const RasterShape& shape, double y, double& x0, double& x1);
+    // Vertical extent of the shape and the row where it is widest
+    static void verticalExtent(const RasterShape& shape, double& top, double& bottom, double& widest);
+};
+
+} // namespace slideEditor::view
+
+#endif // RASTERIZER_HPP
@@ -0,0 +1,63 @@
+#ifndef TILE_RENDERER_HPP
+#define TILE_RENDERER_HPP
+
+#include "view/raster/RasterCanvas.hpp"
+#include "view/raster/Rasterizer.hpp"
+#include "view/raster/ImageWriter.hpp"
+#include "view/WorkStealingPool.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace slideEditor::view {
+
+// Scene indices per tile, in draw order
+struct TileBins {
+    int tileSize;
+    int columns;
+    int rows;
+    std::vector<std::vector<std::uint32_t>> shapes;  // rows * columns lists
+    
+    const std::vector<std::uint32_t>& at(int column, int row) const {
+        return shapes[static_cast<size_t>(row) * columns + column];
+    }
+};
+
+/**
+ * TileRenderer - Renders a scene as independent square tiles on a pool
+ *
+ * Shapes are binned once by bounding box; each tile then only visits the
+ * shapes that can touch it. Images are produced a band of tile rows at a
+ * time, so a whole-deck render streams through ImageWriter without ever
+ * holding the full image. Results are pixel-identical to drawing the
+ * scene into one canvas.
+ */
+class TileRenderer {
+public:
+    static constexpr int DEFAULT_TILE_SIZE = 256;
+    
+    static TileBins binShapes(const std::vector<RasterShape>& scene, int width, int height,
+                              int tileSize = DEFAULT_TILE_SIZE);
+    
+    // tile must cover (column, row), typically a view of a larger canvas; it is cleared first
+    static void renderTile(const std::vector<RasterShape>& scene, const TileBins& bins,
+                           int column, int row, std::uint32_t background, RasterCanvas& tile);
+    
+    static RasterCanvas render(const std::vector<RasterShape>& scene, int width, int height,
+                               std::uint32_t background, WorkStealingPool& pool,
+                               int tileSize = DEFAULT_TILE_SIZE);
+    
+    // Writer must be open for a width x height image
+    static bool renderToWriter(const std::vector<RasterShape>& scene, int width, int height,
+                               std::uint32_t background, ImageWriter& writer,
+                               WorkStealingPool& pool, int tileSize = DEFAULT_TILE_SIZE);
+
+private:
+    // Renders tile rows [firstRow, firstRow + rowCount) into band, whose origin is at firstRow
+    static void renderBand(const std::vector<RasterShape>& scene, const TileBins& bins,
+                           int firstRow, int rowCount, std::uint32_t background,
+                           RasterCanvas& band, WorkStealingPool& pool);
+};
+
+} // namespace slideEditor::view
+
+#endif // TILE_RENDERER_HPP
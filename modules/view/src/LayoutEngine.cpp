@@ -0,0 +1,168 @@
+#include "view/LayoutEngine.hpp"
+#include "view/SlideLayout.hpp"
+#include "model/shapes/Shape.hpp"
+#include <algorithm>
+
+namespace slideEditor::view {
+
+namespace {
+    // Packed shapes fill the area the grid cells span, below the title and content text
+    constexpr double PACK_LEFT = SlideLayout::START_X - SlideLayout::SHAPE_SPACING_X / 2.0;
+    constexpr double PACK_RIGHT = SlideLayout::SLIDE_WIDTH - PACK_LEFT;
+    constexpr double PACK_TOP = SlideLayout::START_Y - SlideLayout::SHAPE_SPACING_Y / 2.0;
+    constexpr double PACK_BOTTOM = SlideLayout::SLIDE_HEIGHT - PACK_LEFT;  // Clear of the theme text
+    constexpr double PACK_SHRINK_STEP = 0.95;  // Least a repack shrinks by, so it always ends
+
+    model::BoundingBox boundsAt(const core::IShape* shape, double x, double y) {
+        const auto* modelShape = dynamic_cast<const model::Shape*>(shape);
+        // Geometry is only known for model shapes; others occupy a point
+        return modelShape ? modelShape->getBounds(x, y) : model::BoundingBox(x, y);
+    }
+
+    // Shelf packing: shapes go left to right in deck order; a shape that does not
+    // fit the remaining width opens a new row below the tallest shape of the last one.
+    // Extents are bounds around the anchor; returns the bottom of the last row
+    double packRows(const std::vector<model::BoundingBox>& extents, double scale,
+                    std::vector<ShapePlacement>& placements) {
+        placements.clear();
+        const double gap = LayoutEngine::PACK_GAP * scale;
+        double cursorX = PACK_LEFT;
+        double rowTop = PACK_TOP;
+        double rowHeight = 0;
+        for (const auto& extent : extents) {
+            const double width = extent.width * scale;
+            const double height = extent.height * scale;
+            if (cursorX > PACK_LEFT && cursorX + width > PACK_RIGHT) {
+                rowTop += rowHeight + gap;
+                cursorX = PACK_LEFT;
+                rowHeight = 0;
+            }
+
+            // The extent's corner is offset from the anchor, and shrinks with the shape
+            const double x = cursorX - extent.x * scale;
+            const double y = rowTop - extent.y * scale;
+            placements.push_back(ShapePlacement{
+                x, y, model::BoundingBox(cursorX, rowTop, width, height), scale
+            });
+
+            cursorX += width + gap;
+            rowHeight = std::max(rowHeight, height);
+        }
+
+        return rowTop + rowHeight;
+    }
+}
+
+const std::vector<ShapePlacement>& LayoutEngine::layout(const core::ISlide* slide,
+                                                        LayoutMode mode) {
+    Entry& entry = entries_[slide->getId()];
+    entry.pass = pass_;
+    if (entry.version == slide->getVersion() && entry.mode == mode &&
+        entry.placements.size() == slide->getShapes().size()) {
+        hits_++;
+        return entry.placements;
+    }
+
+    misses_++;
+    entry.version = slide->getVersion();
+    entry.mode = mode;
+    if (mode == LayoutMode::PACKED) {
+        computePacked(slide, entry.placements);
+    }
+    else {
+        computeGrid(slide, entry.placements);
+    }
+
+    return entry.placements;
+}
+
+int LayoutEngine::hitTest(const core::ISlide* slide, double x, double y, LayoutMode mode) {
+    const auto& placements = layout(slide, mode);
+    for (size_t i = placements.size(); i-- > 0;) {
+        if (placements[i].bounds.contains(x, y)) {
+            return static_cast<int>(i);
+        }
+    }
+
+    return -1;
+}
+
+std::vector<std::pair<size_t, size_t>> LayoutEngine::findOverlaps(const core::ISlide* slide,
+                                                                  LayoutMode mode) {
+    const auto& placements = layout(slide, mode);
+    std::vector<std::pair<size_t, size_t>> overlaps;
+    for (size_t i = 0; i < placements.size(); ++i) {
+        for (size_t j = i + 1; j < placements.size(); ++j) {
+            if (placements[i].bounds.intersects(placements[j].bounds)) {
+                overlaps.emplace_back(i, j);
+            }
+        }
+    }
+
+    return overlaps;
+}
+
+void LayoutEngine::prune() {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.pass != pass_) {
+            it = entries_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    pass_++;
+}
+
+void LayoutEngine::clear() {
+    entries_.clear();
+}
+
+size_t LayoutEngine::getEntryCount() const {
+    return entries_.size();
+}
+
+size_t LayoutEngine::getHitCount() const {
+    return hits_;
+}
+
+size_t LayoutEngine::getMissCount() const {
+    return misses_;
+}
+
+void LayoutEngine::computeGrid(const core::ISlide* slide, std::vector<ShapePlacement>& placements) {
+    const auto& shapes = slide->getShapes();
+    placements.clear();
+    placements.reserve(shapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        double x = 0;
+        double y = 0;
+        SlideLayout::shapeCenter(i, shapes.size(), 0, x, y);
+        placements.push_back(ShapePlacement{x, y, boundsAt(shapes[i].get(), x, y)});
+    }
+}
+
+void LayoutEngine::computePacked(const core::ISlide* slide, std::vector<ShapePlacement>& placements) {
+    const auto& shapes = slide->getShapes();
+    placements.reserve(shapes.size());
+
+    // Bounds around the origin give the offset from the box corner to the anchor
+    std::vector<model::BoundingBox> extents;
+    extents.reserve(shapes.size());
+    double widest = 0;
+    for (const auto& shape : shapes) {
+        extents.push_back(boundsAt(shape.get(), 0, 0));
+        widest = std::max(widest, extents.back().width);
+    }
+
+    // Rows that run past the slide are packed again with every shape and gap
+    // shrunk by the overflow, rather than spilling onto the next slide
+    double scale = widest > PACK_RIGHT - PACK_LEFT ? (PACK_RIGHT - PACK_LEFT) / widest : 1.0;
+    double bottom = packRows(extents, scale, placements);
+    while (bottom > PACK_BOTTOM) {
+        scale *= std::min(PACK_SHRINK_STEP, (PACK_BOTTOM - PACK_TOP) / (bottom - PACK_TOP));
+        bottom = packRows(extents, scale, placements);
+    }
+}
+
+} // namespace slideEditor::view
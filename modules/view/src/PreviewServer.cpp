@@ -0,0 +1,398 @@
+#include "view/PreviewServer.hpp"
+#include "view/SlideLayout.hpp"
+#include <algorithm>
+
+#ifndef _WIN32
+    #include <arpa/inet.h>
+    #include <fcntl.h>
+    #include <netinet/in.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/time.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+#ifndef MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0  // SO_NOSIGPIPE is set instead where available
+#endif
+
+namespace slideEditor::view {
+
+namespace {
+    constexpr size_t MAX_REQUEST_BYTES = 8192;
+
+    const char* const EVENT_STREAM_HEADER =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: keep-alive\r\n"
+        "\r\n";
+
+    std::string response(const char* status, const char* contentType, const std::string& body) {
+        std::string out = "HTTP/1.1 ";
+        out += status;
+        out += "\r\nContent-Type: ";
+        out += contentType;
+        out += "\r\nContent-Length: ";
+        out += std::to_string(body.size());
+        out += "\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n";
+        out += body;
+
+        return out;
+    }
+}
+
+PreviewServer::PreviewServer()
+    : running_(false), listenFd_(-1), wakeFds_{-1, -1}, port_(0) {}
+
+PreviewServer::~PreviewServer() {
+    stop();
+}
+
+#ifndef _WIN32
+
+bool PreviewServer::start(int port) {
+    if (running_) {
+        return true;
+    }
+
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) {
+        return false;
+    }
+
+    int reuse = 1;
+    ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);  // Never exposed beyond this machine
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    socklen_t length = sizeof(address);
+    if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd_, 16) != 0 ||
+        ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&address), &length) != 0 ||
+        ::pipe(wakeFds_) != 0) {
+        ::close(listenFd_);
+        listenFd_ = -1;
+        return false;
+    }
+
+    port_ = ntohs(address.sin_port);
+    running_ = true;
+    thread_ = std::thread(&PreviewServer::serve, this);
+
+    return true;
+}
+
+void PreviewServer::stop() {
+    if (!running_) {
+        return;
+    }
+
+    running_ = false;
+    char wake = 0;
+    if (::write(wakeFds_[1], &wake, 1) < 0) {
+        // The flag alone stops the loop at its next wakeup
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int client : clients_) {
+        ::close(client);
+    }
+
+    clients_.clear();
+    ::close(listenFd_);
+    ::close(wakeFds_[0]);
+    ::close(wakeFds_[1]);
+    listenFd_ = -1;
+    wakeFds_[0] = wakeFds_[1] = -1;
+}
+
+void PreviewServer::serve() {
+    std::vector<pollfd> fds;
+    char scratch[256];
+    while (running_) {
+        fds.clear();
+        fds.push_back(pollfd{wakeFds_[0], POLLIN, 0});
+        fds.push_back(pollfd{listenFd_, POLLIN, 0});
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (int client : clients_) {
+                fds.push_back(pollfd{client, POLLIN, 0});
+            }
+        }
+
+        if (::poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            break;
+        }
+        if (fds[0].revents != 0) {
+            break;  // stop()
+        }
+
+        // Event streams never send after the request, so readability means closed
+        for (size_t i = 2; i < fds.size(); ++i) {
+            if (fds[i].revents == 0 || ::recv(fds[i].fd, scratch, sizeof(scratch), MSG_DONTWAIT) > 0) {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            clients_.erase(std::remove(clients_.begin(), clients_.end(), fds[i].fd), clients_.end());
+            ::close(fds[i].fd);
+        }
+
+        if (fds[1].revents & POLLIN) {
+            int fd = ::accept(listenFd_, nullptr, nullptr);
+            if (fd >= 0) {
+                handleConnection(fd);
+            }
+        }
+    }
+}
+
+void PreviewServer::handleConnection(int fd) {
+#ifdef SO_NOSIGPIPE
+    int noSignal = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+    timeval timeout{1, 0};  // A stalled local client must not hold up the server
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_BYTES) {
+        ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (received <= 0) {
+            ::close(fd);
+            return;
+        }
+
+        request.append(buffer, static_cast<size_t>(received));
+    }
+
+    // Request line: METHOD SP PATH SP VERSION
+    size_t methodEnd = request.find(' ');
+    size_t pathEnd = methodEnd == std::string::npos ? methodEnd : request.find(' ', methodEnd + 1);
+    std::string method = request.substr(0, methodEnd);
+    std::string path = pathEnd == std::string::npos
+        ? std::string() : request.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+
+    if (method != "GET") {
+        std::string reply = response("405 Method Not Allowed", "text/plain", "GET only\n");
+        sendAll(fd, reply.data(), reply.size(), true);
+        ::close(fd);
+        return;
+    }
+
+    if (path == "/events") {
+        // Snapshot and registration happen under the lock so no publish falls in between
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::string stream = EVENT_STREAM_HEADER;
+        appendSnapshot(stream);
+        if (sendAll(fd, stream.data(), stream.size(), true)) {
+            clients_.push_back(fd);
+        }
+        else {
+            ::close(fd);
+        }
+
+        return;
+    }
+
+    std::string reply = (path == "/" || path == "/index.html")
+        ? response("200 OK", "text/html; charset=utf-8", pageHtml())
+        : response("404 Not Found", "text/plain", "Not found\n");
+    sendAll(fd, reply.data(), reply.size(), true);
+    ::close(fd);
+}
+
+void PreviewServer::broadcast(const std::string& events) {
+    for (int client : clients_) {
+        // A client too slow to take the update is cut off; its EventSource reconnects
+        // and gets a fresh snapshot. serve() closes the socket once it sees the hangup.
+        if (!sendAll(client, events.data(), events.size(), false)) {
+            ::shutdown(client, SHUT_RDWR);
+        }
+    }
+}
+
+bool PreviewServer::sendAll(int fd, const char* data, size_t size, bool wait) {
+    const int flags = MSG_NOSIGNAL | (wait ? 0 : MSG_DONTWAIT);
+    while (size > 0) {
+        ssize_t sent = ::send(fd, data, size, flags);
+        if (sent <= 0) {
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+
+            return false;
+        }
+
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+
+    return true;
+}
+
+#else
+
+bool PreviewServer::start(int) {
+    return false;
+}
+
+void PreviewServer::stop() {}
+void PreviewServer::serve() {}
+void PreviewServer::handleConnection(int) {}
+void PreviewServer::broadcast(const std::string&) {}
+
+bool PreviewServer::sendAll(int, const char*, size_t, bool) {
+    return false;
+}
+
+#endif
+
+bool PreviewServer::isRunning() const {
+    return running_;
+}
+
+int PreviewServer::getPort() const {
+    return port_;
+}
+
+std::string PreviewServer::getUrl() const {
+    return "http://127.0.0.1:" + std::to_string(port_) + "/";
+}
+
+size_t PreviewServer::publish(const core::ISlideRepository* repository) {
+    if (!repository) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto& slides = repository->getAllSlides();
+    events_.clear();
+    if (slides.size() != published_.size()) {
+        appendDeckEvent(events_, slides.size());
+        published_.resize(slides.size(), {0, 0});  // Version 0 is never issued, so new slots differ
+        fragments_.resize(slides.size());
+    }
+
+    size_t changed = 0;
+    for (size_t i = 0; i < slides.size(); ++i) {
+        const std::pair<int, std::uint64_t> key{slides[i]->getId(), slides[i]->getVersion()};
+        if (published_[i] == key) {
+            continue;
+        }
+
+        fragments_[i] = renderer_.renderSlide(slides[i].get(), 0);
+        published_[i] = key;
+        appendSlideEvent(events_, i, fragments_[i]);
+        changed++;
+    }
+
+    if (!events_.empty() && running_) {
+        broadcast(events_);
+    }
+
+    return changed;
+}
+
+size_t PreviewServer::getClientCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return clients_.size();
+}
+
+void PreviewServer::appendSnapshot(std::string& out) const {
+    appendDeckEvent(out, fragments_.size());
+    for (size_t i = 0; i < fragments_.size(); ++i) {
+        appendSlideEvent(out, i, fragments_[i]);
+    }
+}
+
+void PreviewServer::appendDeckEvent(std::string& out, size_t slideCount) {
+    out += "event: deck\ndata: ";
+    out += std::to_string(slideCount);
+    out += "\n\n";
+}
+
+void PreviewServer::appendSlideEvent(std::string& out, size_t index, const std::string& fragment) {
+    // First data line is the position; each fragment line becomes its own data line
+    out += "event: slide\ndata: ";
+    out += std::to_string(index);
+    out += '\n';
+
+    size_t start = 0;
+    while (start < fragment.size()) {
+        size_t end = fragment.find('\n', start);
+        if (end == std::string::npos) {
+            end = fragment.size();
+        }
+        if (end > start) {
+            out += "data: ";
+            out.append(fragment, start, end - start);
+            out += '\n';
+        }
+
+        start = end + 1;
+    }
+
+    out += '\n';
+}
+
+std::string PreviewServer::pageHtml() {
+    const std::string width = std::to_string(SlideLayout::SLIDE_WIDTH);
+    const std::string height = std::to_string(SlideLayout::SLIDE_PITCH);
+    return
+        "<!DOCTYPE html>\n"
+        "<html>\n"
+        "<head>\n"
+        "  <meta charset=\"UTF-8\">\n"
+        "  <title>Slide Editor Preview</title>\n"
+        "  <style>\n"
+        "    body{background:#f5f5f5;margin:0;font-family:sans-serif}\n"
+        "    #status{position:fixed;top:6px;right:10px;font-size:12px;color:#999}\n"
+        "    .slide{display:block;margin:0 auto}\n"
+        "  </style>\n"
+        "</head>\n"
+        "<body>\n"
+        "  <div id=\"status\">connecting</div>\n"
+        "  <div id=\"deck\"></div>\n"
+        "  <script>\n"
+        "    const deck = document.getElementById('deck');\n"
+        "    const statusLine = document.getElementById('status');\n"
+        "    const SVG_NS = 'http://www.w3.org/2000/svg';\n"
+        "    function resize(count) {\n"
+        "      while (deck.children.length > count) deck.lastChild.remove();\n"
+        "      while (deck.children.length < count) {\n"
+        "        const svg = document.createElementNS(SVG_NS, 'svg');\n"
+        "        svg.setAttribute('class', 'slide');\n"
+        "        svg.setAttribute('width', '" + width + "');\n"
+        "        svg.setAttribute('height', '" + height + "');\n"
+        "        deck.appendChild(svg);\n"
+        "      }\n"
+        "    }\n"
+        "    const events = new EventSource('/events');\n"
+        "    events.onopen = () => { statusLine.textContent = 'live'; };\n"
+        "    events.onerror = () => { statusLine.textContent = 'reconnecting'; };\n"
+        "    events.addEventListener('deck', e => resize(parseInt(e.data, 10)));\n"
+        "    events.addEventListener('slide', e => {\n"
+        "      const split = e.data.indexOf('\\n');\n"
+        "      const slide = deck.children[parseInt(e.data.slice(0, split), 10)];\n"
+        "      if (slide) slide.innerHTML = e.data.slice(split + 1);\n"
+        "    });\n"
+        "  </script>\n"
+        "</body>\n"
+        "</html>\n";
+}
+
+} // namespace slideEditor::view
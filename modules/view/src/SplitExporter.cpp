@@ -0,0 +1,136 @@
+#include "view/SplitExporter.hpp"
+#include "view/SlideLayout.hpp"
+#include <atomic>
+#include <filesystem>
+#include <system_error>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+namespace slideEditor::view {
+
+bool SplitExporter::exportSlides(const core::ISlideRepository* repository,
+                                 const std::string& directory,
+                                 const SvgOptions& options, SplitExportStats& stats,
+                                 WorkStealingPool* pool) {
+    stats = SplitExportStats();
+    if (!repository) {
+        return false;
+    }
+    
+    std::error_code ec;
+    fs::path root(directory);
+    fs::create_directories(root, ec);
+    if (!fs::is_directory(root, ec)) {
+        return false;
+    }
+    
+    DirectoryState& state = directories_[fs::absolute(root, ec).lexically_normal().string()];
+    if (state.options != options) {
+        state.versions.clear();  // Every file changes with the output mode
+        state.options = options;
+    }
+    
+    // Pick out slides whose file is stale
+    const auto& slides = repository->getAllSlides();
+    std::vector<size_t> stale;
+    std::vector<int> slideIds;
+    std::unordered_set<int> current;
+    slideIds.reserve(slides.size());
+    for (size_t i = 0; i < slides.size(); ++i) {
+        int id = slides[i]->getId();
+        slideIds.push_back(id);
+        current.insert(id);
+        
+        auto it = state.versions.find(id);
+        if (it != state.versions.end() && it->second == slides[i]->getVersion() &&
+            fs::exists(root / slideFilename(id), ec)) {
+            stats.unchanged++;
+        }
+        else {
+            stale.push_back(i);
+        }
+    }
+    
+    // Slides only read here, so they can be rendered side by side
+    std::vector<char> saved(stale.size(), 0);
+    WorkStealingPool& workers = pool ? *pool : WorkStealingPool::shared();
+    workers.parallelFor(stale.size(), [&](size_t k) {
+        size_t index = stale[k];
+        std::string path = (root / slideFilename(slides[index]->getId())).string();
+        saved[k] = SvgGenerator::generateAndSaveRange(repository, path, index, index + 1,
+                                                      nullptr, options);
+    });
+    
+    bool ok = true;
+    for (size_t k = 0; k < stale.size(); ++k) {
+        const core::ISlide* slide = slides[stale[k]].get();
+        if (saved[k]) {
+            state.versions[slide->getId()] = slide->getVersion();
+            stats.written++;
+        }
+        else {
+            state.versions.erase(slide->getId());
+            ok = false;
+        }
+    }
+    
+    for (auto it = state.versions.begin(); it != state.versions.end();) {
+        if (current.count(it->first) == 0) {
+            fs::remove(root / slideFilename(it->first), ec);
+            stats.removed++;
+            it = state.versions.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    
+    std::string index = generateIndex(slideIds);
+    if (index != state.index || !fs::exists(root / INDEX_FILENAME, ec)) {
+        if (SvgGenerator::saveToFile(index, (root / INDEX_FILENAME).string())) {
+            state.index = std::move(index);
+        }
+        else {
+            ok = false;
+        }
+    }
+    
+    return ok;
+}
+
+void SplitExporter::reset() {
+    directories_.clear();
+}
+
+std::string SplitExporter::slideFilename(int slideId) {
+    return "slide-" + std::to_string(slideId) + ".svg";
+}
+
+std::string SplitExporter::generateIndex(const std::vector<int>& slideIds) {
+    const std::string size = "\" width=\"" + std::to_string(SlideLayout::SLIDE_WIDTH) + 
+                             "\" height=\"" + std::to_string(SlideLayout::SLIDE_PITCH) + "\"";
+    std::string html =
+        "<!DOCTYPE html>\n"
+        "<html>\n"
+        "<head>\n"
+        "  <meta charset=\"UTF-8\">\n"
+        "  <title>Presentation</title>\n"
+        "  <style>body{background:#f5f5f5;margin:0} img{display:block;margin:0 auto}</style>\n"
+        "</head>\n"
+        "<body>\n";
+    
+    for (size_t i = 0; i < slideIds.size(); ++i) {
+        html += "  <img src=\"";
+        html += slideFilename(slideIds[i]);
+        html += "\" alt=\"Slide ";
+        html += std::to_string(i + 1);
+        html += size;
+        html += " loading=\"lazy\">\n";
+    }
+    
+    html += "</body>\n</html>\n";
+    return html;
+}
+
+} // namespace slideEditor::view
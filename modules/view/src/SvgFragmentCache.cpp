@@ -0,0 +1,91 @@
+#include "view/SvgFragmentCache.hpp"
+#include <functional>
+
+namespace slideEditor::view {
+
+size_t SvgFragmentCache::KeyHash::operator()(const Key& key) const {
+    size_t h = std::hash<std::uint64_t>()(key.version);
+    h ^= std::hash<int>()(key.slideId) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= std::hash<int>()(key.slideNumber) + 0x9e3779b9 + (h << 6) + (h >> 2);
+
+    return h;
+}
+
+SvgFragmentCache::SvgFragmentCache(size_t memoryBudget)
+    : memoryBudget_(memoryBudget), memoryUsage_(0), hits_(0), misses_(0) {}
+
+const std::string* SvgFragmentCache::find(int slideId, std::uint64_t version, int slideNumber) {
+    auto it = index_.find(Key{slideId, version, slideNumber});
+    if (it == index_.end()) {
+        ++misses_;
+        return nullptr;
+    }
+
+    // Move to front (most recently used)
+    entries_.splice(entries_.begin(), entries_, it->second);
+    ++hits_;
+
+    return &it->second->fragment;
+}
+
+void SvgFragmentCache::store(int slideId, std::uint64_t version, int slideNumber,
+                             std::string fragment) {
+    Key key{slideId, version, slideNumber};
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        memoryUsage_ -= it->second->fragment.size();
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+
+    if (fragment.size() > memoryBudget_) {
+        return;  // Would never fit
+    }
+
+    evictUntilFits(fragment.size());
+    memoryUsage_ += fragment.size();
+    entries_.push_front(Entry{key, std::move(fragment)});
+    index_[key] = entries_.begin();
+}
+
+void SvgFragmentCache::clear() {
+    entries_.clear();
+    index_.clear();
+    memoryUsage_ = 0;
+}
+
+void SvgFragmentCache::setMemoryBudget(size_t bytes) {
+    memoryBudget_ = bytes;
+    evictUntilFits(0);
+}
+
+size_t SvgFragmentCache::getMemoryBudget() const {
+    return memoryBudget_;
+}
+
+size_t SvgFragmentCache::getMemoryUsage() const {
+    return memoryUsage_;
+}
+
+size_t SvgFragmentCache::getEntryCount() const {
+    return entries_.size();
+}
+
+size_t SvgFragmentCache::getHitCount() const {
+    return hits_;
+}
+
+size_t SvgFragmentCache::getMissCount() const {
+    return misses_;
+}
+
+void SvgFragmentCache::evictUntilFits(size_t incoming) {
+    while (!entries_.empty() && memoryUsage_ + incoming > memoryBudget_) {
+        const Entry& victim = entries_.back();
+        memoryUsage_ -= victim.fragment.size();
+        index_.erase(victim.key);
+        entries_.pop_back();
+    }
+}
+
+} // namespace slideEditor::view
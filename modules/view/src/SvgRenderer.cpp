@@ -0,0 +1,411 @@
+#include "view/SvgRenderer.hpp"
+#include "view/SlideLayout.hpp"
+#include "model/SvgFormatter.hpp"
+#include <algorithm>
+#include <charconv>
+
+namespace slideEditor::view {
+
+using model::SvgFormatter;
+
+namespace {
+    constexpr const char* EMPTY_DOCUMENT = R"(<?xml version="1.0" encoding="UTF-8"?>
+        <svg xmlns="http://www.w3.org/2000/svg" width="800" height="600">
+        <rect width="100%" height="100%" fill="#f0f0f0"/>
+        <text x="400" y="300" text-anchor="middle" font-size="24" fill="#333">
+        No slides to display
+        </text>
+        </svg>)";
+
+    // Slide chrome is identical on every slide, so its classes are fixed
+    constexpr const char* CHROME_STYLES = 
+        "  <style>\n"
+        "    .frame{fill:white;stroke:#333;stroke-width:2}\n"
+        "    .title{text-anchor:middle;font-size:28px;font-weight:bold;fill:#333}\n"
+        "    .content{text-anchor:middle;font-size:18px;fill:#666}\n"
+        "    .theme{font-size:14px;fill:#999}\n";
+
+    // Interned markup is dropped once it outgrows the last document by this factor,
+    // so styles of deleted shapes do not pile up for the renderer's lifetime
+    constexpr size_t INTERN_SLACK = 4;
+    constexpr size_t INTERN_FLOOR = 64;  // Small decks never reset
+
+    constexpr int SVG_WIDTH = SlideLayout::SLIDE_WIDTH;
+    constexpr int SVG_HEIGHT = SlideLayout::SLIDE_HEIGHT;
+
+    inline void appendInt(std::string& out, long long value) {
+        char buffer[24];
+        auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, end);
+    }
+}
+
+void SvgRenderer::InternTable::beginDocument() {
+    if (ids.size() > INTERN_SLACK * std::max(docCount, INTERN_FLOOR)) {
+        ids.clear();
+        docIds.clear();
+    }
+    std::fill(docIds.begin(), docIds.end(), NONE);
+    shapeIds.clear();
+    markup.clear();
+    docCount = 0;
+}
+
+size_t SvgRenderer::InternTable::intern(const std::string& key, bool& firstInDocument) {
+    auto it = ids.find(key);
+    if (it == ids.end()) {
+        it = ids.emplace(key, ids.size()).first;
+        docIds.push_back(NONE);
+    }
+
+    size_t& docId = docIds[it->second];
+    firstInDocument = docId == NONE;
+    if (firstInDocument) {
+        docId = docCount++;
+    }
+
+    return docId;
+}
+
+const std::string& SvgRenderer::render(const core::ISlideRepository* repository,
+                                       size_t first, size_t last,
+                                       SvgFragmentCache* cache,
+                                       const SvgOptions& options) {
+    output_.clear();
+    if (!repository) {
+        return output_;
+    }
+    
+    const auto& slides = repository->getAllSlides();
+    last = std::min(last, slides.size());
+    draws_++;
+    if (first >= last) {
+        output_ += EMPTY_DOCUMENT;
+        layout_.prune();
+        return output_;
+    }
+    
+    const size_t count = last - first;
+    reserveFor(output_, count * bytesPerSlide_);
+    
+    // SVG header
+    output_ += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+               "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"";
+    appendInt(output_, SVG_WIDTH);
+    output_ += "\" height=\"";
+    appendInt(output_, static_cast<long long>(count) * SlideLayout::SLIDE_PITCH);
+    output_ += "\">\n";
+    
+    // Background
+    output_ += "  <rect width=\"100%\" height=\"100%\" fill=\"#f5f5f5\"/>\n\n";
+    if (options.shapeDefs || options.styleClasses || options.layout != LayoutMode::GRID || !cache) {
+        // Def and class ids depend on the whole document, and cache entries do not
+        // record their layout, so these documents are drawn without the cache
+        if (options.styleClasses) {
+            collectStyleClasses(slides, first, last);
+            output_ += styles_.markup;
+        }
+        if (options.shapeDefs) {
+            collectShapeDefs(slides, first, last, options.styleClasses);
+            output_ += defs_.markup;
+        }
+        
+        size_t shapeCursor = 0;
+        int slideNumber = 0;
+        for (size_t i = first; i < last; ++i) {
+            appendSlide(output_, slides[i].get(), slideNumber, options.shapeDefs,
+                        options.styleClasses, options.layout, shapeCursor);
+            slideNumber++;
+        }
+    }
+    else {
+        int slideNumber = 0;  // Position within this document
+        for (size_t i = first; i < last; ++i) {
+            const core::ISlide* slide = slides[i].get();
+            size_t shapeCursor = 0;
+            int id = slide->getId();
+            std::uint64_t version = slide->getVersion();
+            if (const std::string* cached = cache->find(id, version, slideNumber)) {
+                output_ += *cached;
+            }
+            else {
+                fragment_.clear();
+                appendSlide(fragment_, slide, slideNumber, false, false, LayoutMode::GRID,
+                            shapeCursor);
+                noteScratch(fragment_);
+                output_ += fragment_;
+                cache->store(id, version, slideNumber, fragment_);
+            }
+            
+            slideNumber++;
+        }
+    }
+    
+    // SVG footer
+    output_ += "</svg>\n";
+    outputHighWater_ = std::max(outputHighWater_, output_.size());
+    bytesPerSlide_ = output_.size() / count;  // Rounded down so an equal deck never regrows
+    layout_.prune();  // Placements of removed slides
+    
+    return output_;
+}
+
+bool SvgRenderer::renderToFile(const core::ISlideRepository* repository,
+                               const std::string& filename,
+                               size_t first, size_t last,
+                               SvgFragmentCache* cache,
+                               const SvgOptions& options) {
+    if (!repository) {
+        return false;
+    }
+    
+    return SvgGenerator::saveToFile(render(repository, first, last, cache, options), filename);
+}
+
+const std::string& SvgRenderer::renderSlide(const core::ISlide* slide, int slideNumber,
+                                            LayoutMode layout) {
+    size_t shapeCursor = 0;
+    fragment_.clear();
+    appendSlide(fragment_, slide, slideNumber, false, false, layout, shapeCursor);
+    noteScratch(fragment_);
+    
+    return fragment_;
+}
+
+LayoutEngine& SvgRenderer::getLayoutEngine() {
+    return layout_;
+}
+
+std::string SvgRenderer::takeOutput() {
+    std::string document = std::move(output_);
+    output_.clear();
+    
+    return document;
+}
+
+void SvgRenderer::release() {
+    std::string().swap(output_);
+    std::string().swap(fragment_);
+    std::string().swap(key_);
+    styles_ = InternTable();
+    defs_ = InternTable();
+    layout_.clear();
+    bytesPerSlide_ = 0;
+}
+
+size_t SvgRenderer::getDrawCount() const {
+    return draws_;
+}
+
+size_t SvgRenderer::getOutputHighWater() const {
+    return outputHighWater_;
+}
+
+size_t SvgRenderer::getScratchHighWater() const {
+    return scratchHighWater_;
+}
+
+size_t SvgRenderer::getInternedCount() const {
+    return styles_.ids.size() + defs_.ids.size();
+}
+
+size_t SvgRenderer::getReservedBytes() const {
+    return output_.capacity() + fragment_.capacity() + key_.capacity() +
+           styles_.markup.capacity() + defs_.markup.capacity();
+}
+
+void SvgRenderer::collectStyleClasses(const std::vector<std::unique_ptr<core::ISlide>>& slides,
+                                      size_t first, size_t last) {
+    styles_.beginDocument();
+    styles_.markup += CHROME_STYLES;
+    for (size_t i = first; i < last; ++i) {
+        for (const auto& shape : slides[i]->getShapes()) {
+            key_.clear();
+            shape->appendStyleRule(key_);
+            
+            bool firstUse = false;
+            size_t classId = styles_.intern(key_, firstUse);
+            if (firstUse) {
+                char name[24];
+                styles_.markup += "    .";
+                styles_.markup += className(name, classId);
+                styles_.markup += '{';
+                styles_.markup += key_;
+                styles_.markup += "}\n";
+            }
+            
+            styles_.shapeIds.push_back(classId);
+        }
+    }
+    
+    styles_.markup += "  </style>\n\n";
+    noteScratch(styles_.markup);
+}
+
+void SvgRenderer::collectShapeDefs(const std::vector<std::unique_ptr<core::ISlide>>& slides,
+                                   size_t first, size_t last, bool styleClasses) {
+    // A shape drawn at the origin with inline style fully describes its (type, scale,
+    // stroke, fill), so that markup is the dedup key and, wrapped in a <g>, the definition
+    size_t shapeCursor = 0;
+    defs_.beginDocument();
+    defs_.markup += "  <defs>\n";
+    for (size_t i = first; i < last; ++i) {
+        for (const auto& shape : slides[i]->getShapes()) {
+            key_.clear();
+            shape->appendSVG(key_, 0, 0);
+            
+            bool firstUse = false;
+            size_t defId = defs_.intern(key_, firstUse);
+            if (firstUse) {
+                defs_.markup += "    <g id=\"shape-";
+                appendInt(defs_.markup, static_cast<long long>(defId));
+                defs_.markup += "\">";
+                if (styleClasses) {
+                    char name[24];
+                    shape->appendSVG(defs_.markup, 0, 0, className(name, styles_.shapeIds[shapeCursor]));
+                }
+                else {
+                    defs_.markup += key_;
+                }
+                
+                defs_.markup += "</g>\n";
+            }
+            
+            defs_.shapeIds.push_back(defId);
+            shapeCursor++;
+        }
+    }
+    
+    defs_.markup += "  </defs>\n\n";
+    noteScratch(defs_.markup);
+}
+
+void SvgRenderer::appendSlide(std::string& out, const core::ISlide* slide, int slideNumber,
+                              bool shapeDefs, bool styleClasses, LayoutMode layout,
+                              size_t& shapeCursor) {
+    const int offsetY = SlideLayout::slideOffsetY(slideNumber);
+    // Slide group
+    out += "  <g id=\"slide-";
+    appendInt(out, slide->getId());
+    out += "\">\n";
+    
+    // Slide background
+    out += styleClasses ? "    <rect class=\"frame\" x=\"10\" y=\"" : "    <rect x=\"10\" y=\"";
+    appendInt(out, offsetY + 10);
+    out += "\" width=\"";
+    appendInt(out, SVG_WIDTH - 20);
+    out += "\" height=\"";
+    appendInt(out, SVG_HEIGHT - 20);
+    out += styleClasses ? "\" rx=\"5\"/>\n" 
+                        : "\" fill=\"white\" stroke=\"#333\" stroke-width=\"2\" rx=\"5\"/>\n";
+    
+    // Slide title
+    out += styleClasses ? "    <text class=\"title\" x=\"" : "    <text x=\"";
+    appendInt(out, SVG_WIDTH / 2);
+    out += "\" y=\"";
+    appendInt(out, offsetY + 40);
+    out += styleClasses ? "\">" 
+                        : "\" text-anchor=\"middle\" font-size=\"28\" font-weight=\"bold\" fill=\"#333\">";
+    SvgFormatter::appendEscaped(out, slide->getTitle());
+    out += "</text>\n";
+    
+    // Slide content
+    out += styleClasses ? "    <text class=\"content\" x=\"" : "    <text x=\"";
+    appendInt(out, SVG_WIDTH / 2);
+    out += "\" y=\"";
+    appendInt(out, offsetY + 70);
+    out += styleClasses ? "\">" : "\" text-anchor=\"middle\" font-size=\"18\" fill=\"#666\">";
+    SvgFormatter::appendEscaped(out, slide->getContent());
+    out += "</text>\n";
+    
+    // Theme indicator
+    out += styleClasses ? "    <text class=\"theme\" x=\"20\" y=\"" : "    <text x=\"20\" y=\"";
+    appendInt(out, offsetY + SVG_HEIGHT - 20);
+    out += styleClasses ? "\">Theme: " : "\" font-size=\"14\" fill=\"#999\">Theme: ";
+    SvgFormatter::appendEscaped(out, slide->getTheme());
+    out += "</text>\n";
+    
+    // Shapes
+    const auto& shapes = slide->getShapes();
+    const auto& placements = layout_.layout(slide, layout);
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        double x = placements[i].x;
+        double y = offsetY + placements[i].y;
+        const bool scaled = placements[i].scale != 1.0;
+        
+        out += "    ";
+        if (shapeDefs) {
+            // Style lives in the def
+            out += "<use href=\"#shape-";
+            appendInt(out, static_cast<long long>(defs_.shapeIds[shapeCursor++]));
+            if (scaled) {
+                out += "\" transform=\"";
+                appendTransform(out, x, y, placements[i].scale);
+            }
+            else {
+                out += "\" x=\"";
+                SvgFormatter::appendNumber(out, x);
+                out += "\" y=\"";
+                SvgFormatter::appendNumber(out, y);
+            }
+            out += "\" />";
+        }
+        else {
+            // A shrunk packed shape is drawn at the origin of a scaled group
+            if (scaled) {
+                out += "<g transform=\"";
+                appendTransform(out, x, y, placements[i].scale);
+                out += "\">";
+                x = 0;
+                y = 0;
+            }
+            if (styleClasses) {
+                char name[24];
+                shapes[i]->appendSVG(out, x, y, className(name, styles_.shapeIds[shapeCursor++]));
+            }
+            else {
+                shapes[i]->appendSVG(out, x, y);
+            }
+            if (scaled) {
+                out += "</g>";
+            }
+        }
+        
+        out += '\n';
+    }
+    
+    out += "  </g>\n\n";
+}
+
+void SvgRenderer::noteScratch(const std::string& buffer) {
+    scratchHighWater_ = std::max(scratchHighWater_, buffer.size());
+}
+
+void SvgRenderer::reserveFor(std::string& buffer, size_t needed) {
+    // reserve() below capacity may shrink, so only ever grow, at least doubling
+    if (needed > buffer.capacity()) {
+        buffer.reserve(std::max(needed, 2 * buffer.capacity()));
+    }
+}
+
+void SvgRenderer::appendTransform(std::string& out, double x, double y, double scale) {
+    out += "translate(";
+    SvgFormatter::appendNumber(out, x);
+    out += ' ';
+    SvgFormatter::appendNumber(out, y);
+    // Shortest exact form; coordinate precision would move large shapes off their bounds
+    char buffer[32];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), scale);
+    out += ") scale(";
+    out.append(buffer, static_cast<size_t>(end - buffer));
+    out += ')';
+}
+
+std::string_view SvgRenderer::className(char (&buffer)[24], size_t id) {
+    buffer[0] = 's';
+    auto [end, ec] = std::to_chars(buffer + 1, buffer + sizeof(buffer), id);
+    
+    return std::string_view(buffer, static_cast<size_t>(end - buffer));
+}
+
+} // namespace slideEditor::view
@@ -0,0 +1,154 @@
+#include "view/WorkStealingPool.hpp"
+#include <algorithm>
+
+namespace slideEditor::view {
+
+WorkStealingPool::WorkStealingPool(size_t threadCount)
+    : queued_(0), nextQueue_(0), stopping_(false) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // One extra queue for work submitted from outside the pool
+    for (size_t i = 0; i <= threadCount; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stopping_ = true;
+    }
+
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+size_t WorkStealingPool::getThreadCount() const {
+    return workers_.size();
+}
+
+WorkStealingPool& WorkStealingPool::shared() {
+    static WorkStealingPool pool;
+    return pool;
+}
+
+void WorkStealingPool::parallelFor(size_t count, const std::function<void(size_t)>& task) {
+    if (count == 0) {
+        return;
+    }
+
+    Batch batch;
+    batch.task = &task;
+    batch.remaining.store(count);
+
+    // Contiguous chunks keep neighbouring indices (e.g. adjacent tiles) on one worker
+    const size_t queueCount = queues_.size();
+    const size_t chunk = (count + queueCount - 1) / queueCount;
+    const size_t start = nextQueue_.fetch_add(1) % queueCount;
+    for (size_t q = 0, begin = 0; begin < count; ++q, begin += chunk) {
+        Queue& queue = *queues_[(start + q) % queueCount];
+        size_t end = std::min(count, begin + chunk);
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queued_.fetch_add(end - begin);  // Before the items become poppable
+        for (size_t i = begin; i < end; ++i) {
+            queue.items.push_back(Item{&batch, i});
+        }
+    }
+
+    {
+        // Sleepers check queued_ under this lock, so taking it orders the wakeup
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+    }
+
+    wake_.notify_all();
+
+    // Help out until this batch is finished
+    const size_t self = queueCount - 1;
+    while (batch.remaining.load() > 0) {
+        Item item;
+        if (popOrSteal(self, item)) {
+            run(item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        finished_.wait(lock, [&] { return batch.remaining.load() == 0 || queued_.load() > 0; });
+    }
+
+    if (batch.error) {
+        std::rethrow_exception(batch.error);
+    }
+}
+
+void WorkStealingPool::workerLoop(size_t self) {
+    while (true) {
+        Item item;
+        if (popOrSteal(self, item)) {
+            run(item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        wake_.wait(lock, [this] { return stopping_ || queued_.load() > 0; });
+        if (stopping_ && queued_.load() == 0) {
+            return;
+        }
+    }
+}
+
+bool WorkStealingPool::popOrSteal(size_t self, Item& item) {
+    // Own queue: newest first
+    {
+        Queue& own = *queues_[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.items.empty()) {
+            item = own.items.back();
+            own.items.pop_back();
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Others: oldest first
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+        Queue& victim = *queues_[(self + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.items.empty()) {
+            item = victim.items.front();
+            victim.items.pop_front();
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WorkStealingPool::run(const Item& item) {
+    Batch& batch = *item.batch;
+    try {
+        (*batch.task)(item.index);
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(batch.errorMutex);
+        if (!batch.error) {
+            batch.error = std::current_exception();
+        }
+    }
+
+    if (batch.remaining.fetch_sub(1) == 1) {
+        // Take the lock so a caller between its check and wait cannot miss this
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        finished_.notify_all();
+    }
+}
+
+} // namespace slideEditor::view
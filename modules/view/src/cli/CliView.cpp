@@ -1,17 +1,26 @@
 #include "view/cli/CliView.hpp"
+#include "io/OutputStream.hpp"
 #include <iomanip>
 #include <sstream>
 
 namespace slideEditor::view {
 
-CliView::CliView(std::ostream& output) : output_(output) {}
+CliView::CliView(std::ostream& output)
+    : output_(std::make_shared<io::OutputStream>(output)), buffered_(false) {}
+
+CliView::CliView(std::shared_ptr<core::IOutputStream> output)
+    : output_(std::move(output)), buffered_(true) {}
 
 void CliView::displayMessage(const std::string& message) {
-    output_ << message << std::endl;
+    output_->writeLine(message);
+    if (!buffered_) {
+        output_->flush();
+    }
 }
 
 void CliView::displayError(const std::string& error) {
-    output_ << "[ERROR] " << error << std::endl;
+    output_->writeLine("[ERROR] " + error);
+    output_->flush();
 }
 
 void CliView::displaySlides(const core::ISlideRepository* repository) {
@@ -22,24 +31,31 @@ void CliView::displaySlides(const core::ISlideRepository* repository) {
     
     const auto& slides = repository->getAllSlides();
     if (slides.empty()) {
-        output_ << "No slides in presentation." << std::endl;
+        displayMessage("No slides in presentation.");
         return;
     }
     
-    output_ << "\n========================================\n";
-    output_ << "  PRESENTATION (" << slides.size() << " slide(s))\n";
-    output_ << "========================================\n\n";
+    std::ostringstream oss;
+    oss << "\n========================================\n";
+    oss << "  PRESENTATION (" << slides.size() << " slide(s))\n";
+    oss << "========================================\n\n";
     for (const auto& slide : slides) {
-        output_ << formatSlide(slide.get()) << "\n";
+        oss << formatSlide(slide.get()) << "\n";
     }
+    output_->write(oss.str());
 }
 
 void CliView::displayHelp(const std::string& helpText) {
-    output_ << "\n" << helpText << std::endl;
+    displayMessage("\n" + helpText);
 }
 
 void CliView::displayPrompt() {
-    output_ << "> " << std::flush;
+    output_->write("> ");
+    output_->flush();
+}
+
+void CliView::flush() {
+    output_->flush();
 }
 
 std::string CliView::formatSlide(const core::ISlide* slide) const {
@@ -0,0 +1,384 @@
+#include "view/raster/ImageWriter.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace slideEditor::view {
+
+namespace {
+
+constexpr size_t IDAT_CHUNK_SIZE = 64 * 1024;
+constexpr std::uint32_t ADLER_MOD = 65521;
+constexpr int PNG_FILTER_UP = 2;
+
+// Fixed Huffman code (RFC 1951, 3.2.6) for a literal/length symbol,
+// bit-reversed so it can be emitted LSB-first
+struct FixedCode {
+    std::uint16_t bits;
+    std::uint8_t length;
+};
+
+const std::array<FixedCode, 288>& fixedCodes() {
+    static const std::array<FixedCode, 288> table = [] {
+        std::array<FixedCode, 288> codes{};
+        for (int symbol = 0; symbol < 288; ++symbol) {
+            int code = 0;
+            int length = 0;
+            if (symbol < 144) { code = 0x30 + symbol; length = 8; }
+            else if (symbol < 256) { code = 0x190 + symbol - 144; length = 9; }
+            else if (symbol < 280) { code = symbol - 256; length = 7; }
+            else { code = 0xC0 + symbol - 280; length = 8; }
+
+            int reversed = 0;
+            for (int i = 0; i < length; ++i) {
+                reversed |= ((code >> i) & 1) << (length - 1 - i);
+            }
+
+            codes[symbol] = FixedCode{static_cast<std::uint16_t>(reversed),
+                                      static_cast<std::uint8_t>(length)};
+        }
+
+        return codes;
+    }();
+
+    return table;
+}
+
+constexpr int LENGTH_BASE[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+constexpr int LENGTH_EXTRA[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+void putBigEndian32(unsigned char* out, std::uint32_t value) {
+    out[0] = static_cast<unsigned char>(value >> 24);
+    out[1] = static_cast<unsigned char>(value >> 16);
+    out[2] = static_cast<unsigned char>(value >> 8);
+    out[3] = static_cast<unsigned char>(value);
+}
+
+} // namespace
+
+ImageWriter::~ImageWriter() {
+    if (open_) {
+        close();
+    }
+}
+
+bool ImageWriter::open(const std::string& filename, ImageFormat format, int width, int height) {
+    if (open_ || width <= 0 || height <= 0) {
+        return false;
+    }
+
+    file_.open(filename, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        return false;
+    }
+
+    format_ = format;
+    width_ = width;
+    height_ = height;
+    rowsWritten_ = 0;
+    open_ = true;
+    if (format_ == ImageFormat::PPM) {
+        file_ << "P6\n" << width_ << " " << height_ << "\n255\n";
+        line_.assign(static_cast<size_t>(width_) * 3, 0);
+
+        return file_.good();
+    }
+
+    static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    file_.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+
+    unsigned char header[13] = {};
+    putBigEndian32(header, static_cast<std::uint32_t>(width_));
+    putBigEndian32(header + 4, static_cast<std::uint32_t>(height_));
+    header[8] = 8;   // Bit depth
+    header[9] = 2;   // Truecolor RGB
+    writeChunk("IHDR", header, sizeof(header));
+
+    line_.assign(static_cast<size_t>(width_) * 3 + 1, 0);
+    previous_.assign(static_cast<size_t>(width_) * 3, 0);
+    idat_.clear();
+    bitBuffer_ = 0;
+    bitCount_ = 0;
+    lastByte_ = -1;
+    runLength_ = 0;
+    adlerA_ = 1;
+    adlerB_ = 0;
+
+    // zlib header, then an open (non-final) fixed-Huffman block
+    idat_.push_back(0x78);
+    idat_.push_back(0x01);
+    putBits(0, 1);
+    putBits(1, 2);
+
+    return file_.good();
+}
+
+bool ImageWriter::writeRows(const RasterCanvas& canvas) {
+    if (canvas.getWidth() != width_) {
+        return false;
+    }
+
+    for (int y = 0; y < canvas.getHeight(); ++y) {
+        if (!writeRows(canvas.row(y), 1)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ImageWriter::writeRows(const std::uint32_t* pixels, int rowCount) {
+    if (!open_ || rowsWritten_ + rowCount > height_) {
+        return false;
+    }
+
+    for (int r = 0; r < rowCount; ++r) {
+        const std::uint32_t* row = pixels + static_cast<size_t>(r) * width_;
+        if (format_ == ImageFormat::PPM) {
+            unsigned char* out = line_.data();
+            for (int x = 0; x < width_; ++x) {
+                out[3 * x] = RasterCanvas::red(row[x]);
+                out[3 * x + 1] = RasterCanvas::green(row[x]);
+                out[3 * x + 2] = RasterCanvas::blue(row[x]);
+            }
+
+            file_.write(reinterpret_cast<const char*>(out), static_cast<std::streamsize>(line_.size()));
+        }
+        else {
+            writeRowPNG(row);
+        }
+    }
+
+    rowsWritten_ += rowCount;
+    return file_.good();
+}
+
+void ImageWriter::writeRowPNG(const std::uint32_t* pixels) {
+    const size_t rowBytes = static_cast<size_t>(width_) * 3;
+    unsigned char* filtered = line_.data() + 1;
+    line_[0] = PNG_FILTER_UP;
+    for (int x = 0; x < width_; ++x) {
+        filtered[3 * x] = RasterCanvas::red(pixels[x]);
+        filtered[3 * x + 1] = RasterCanvas::green(pixels[x]);
+        filtered[3 * x + 2] = RasterCanvas::blue(pixels[x]);
+    }
+
+    // Up filter: subtract the previous row, keeping the raw row for the next one
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= rowBytes; i += 16) {
+        __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(filtered + i));
+        __m128i above = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous_.data() + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(previous_.data() + i), raw);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(filtered + i), _mm_sub_epi8(raw, above));
+    }
+#endif
+    for (; i < rowBytes; ++i) {
+        unsigned char raw = filtered[i];
+        filtered[i] = static_cast<unsigned char>(raw - previous_[i]);
+        previous_[i] = raw;
+    }
+
+    putBytes(line_.data(), line_.size());
+    flushIdat(false);
+}
+
+void ImageWriter::putBytes(const unsigned char* data, size_t length) {
+    // Consume whole runs: one scan, one Adler-32 update and one match sequence each
+    size_t i = 0;
+    while (i < length) {
+        const unsigned char value = data[i];
+        size_t end = i + 1;
+#if defined(__SSE2__)
+        const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+        while (end + 16 <= length) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + end));
+            int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+            if (mask != 0xFFFF) {
+                end += static_cast<size_t>(__builtin_ctz(~mask & 0xFFFF));
+                break;
+            }
+
+            end += 16;
+        }
+#endif
+        while (end < length && data[end] == value) {
+            ++end;
+        }
+
+        const std::uint64_t count = end - i;
+        // Adler-32 over `count` copies of value:
+        // a' = a + n*v,  b' = b + n*a + v*n(n+1)/2
+        const std::uint64_t a = adlerA_;
+        adlerA_ = static_cast<std::uint32_t>((a + count * value) % ADLER_MOD);
+        adlerB_ = static_cast<std::uint32_t>(
+            (adlerB_ + (count % ADLER_MOD) * a + value * ((count * (count + 1) / 2) % ADLER_MOD)) 
+            % ADLER_MOD);
+
+        if (value == lastByte_) {
+            runLength_ += count;
+        }
+        else {
+            flushRun();
+            putSymbol(value);
+            lastByte_ = value;
+            runLength_ = count - 1;
+        }
+
+        i = end;
+    }
+}
+
+void ImageWriter::putBits(std::uint32_t bits, int count) {
+    bitBuffer_ |= static_cast<std::uint64_t>(bits) << bitCount_;
+    bitCount_ += count;
+    while (bitCount_ >= 8) {
+        idat_.push_back(static_cast<unsigned char>(bitBuffer_));
+        bitBuffer_ >>= 8;
+        bitCount_ -= 8;
+    }
+}
+
+void ImageWriter::putSymbol(int symbol) {
+    const FixedCode& code = fixedCodes()[symbol];
+    putBits(code.bits, code.length);
+}
+
+void ImageWriter::flushRun() {
+    while (runLength_ >= 3) {
+        int length = static_cast<int>(std::min<std::uint64_t>(runLength_, 258));
+        int code = 28;
+        while (LENGTH_BASE[code] > length) {
+            --code;
+        }
+
+        putSymbol(257 + code);
+        putBits(static_cast<std::uint32_t>(length - LENGTH_BASE[code]), LENGTH_EXTRA[code]);
+        putBits(0, 5);  // Distance code 0: distance 1
+        runLength_ -= static_cast<std::uint64_t>(length);
+    }
+
+    for (; runLength_ > 0; --runLength_) {
+        putSymbol(lastByte_);
+    }
+}
+
+void ImageWriter::flushIdat(bool force) {
+    if (idat_.empty() || (!force && idat_.size() < IDAT_CHUNK_SIZE)) {
+        return;
+    }
+
+    writeChunk("IDAT", idat_.data(), idat_.size());
+    idat_.clear();
+}
+
+void ImageWriter::writeChunk(const char* type, const unsigned char* data, size_t length) {
+    unsigned char header[8];
+    putBigEndian32(header, static_cast<std::uint32_t>(length));
+    std::copy(type, type + 4, header + 4);
+    std::uint32_t crc = crc32(header + 4, 4);
+    crc = crc32(data, length, crc);
+
+    unsigned char trailer[4];
+    putBigEndian32(trailer, crc);
+    file_.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(length));
+    file_.write(reinterpret_cast<const char*>(trailer), sizeof(trailer));
+}
+
+bool ImageWriter::close() {
+    if (!open_) {
+        return false;
+    }
+
+    open_ = false;
+    if (format_ == ImageFormat::PNG) {
+        // End of block, then an empty final stored block to terminate the stream
+        flushRun();
+        putSymbol(256);
+        putBits(1, 3);
+        if (bitCount_ > 0) {
+            putBits(0, 8 - bitCount_);
+        }
+
+        const unsigned char stored[4] = {0x00, 0x00, 0xFF, 0xFF};
+        idat_.insert(idat_.end(), stored, stored + 4);
+
+        unsigned char adler[4];
+        putBigEndian32(adler, (adlerB_ << 16) | adlerA_);
+        idat_.insert(idat_.end(), adler, adler + 4);
+        flushIdat(true);
+        writeChunk("IEND", nullptr, 0);
+    }
+
+    bool complete = rowsWritten_ == height_ && file_.good();
+    file_.close();
+
+    return complete;
+}
+
+bool ImageWriter::save(const RasterCanvas& canvas, const std::string& filename, ImageFormat format) {
+    ImageWriter writer;
+    if (!writer.open(filename, format, canvas.getWidth(), canvas.getHeight())) {
+        return false;
+    }
+
+    writer.writeRows(canvas);
+    return writer.close();
+}
+
+bool ImageWriter::parseFormat(const std::string& name, ImageFormat& format) {
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+
+    if (lower == "png") {
+        format = ImageFormat::PNG;
+        return true;
+    }
+    if (lower == "ppm") {
+        format = ImageFormat::PPM;
+        return true;
+    }
+
+    return false;
+}
+
+const char* ImageWriter::extension(ImageFormat format) {
+    return format == ImageFormat::PPM ? ".ppm" : ".png";
+}
+
+std::uint32_t ImageWriter::crc32(const unsigned char* data, size_t length, std::uint32_t crc) {
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> entries{};
+        for (std::uint32_t n = 0; n < 256; ++n) {
+            std::uint32_t c = n;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+
+            entries[n] = c;
+        }
+
+        return entries;
+    }();
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+} // namespace slideEditor::view
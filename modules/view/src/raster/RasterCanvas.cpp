@@ -0,0 +1,147 @@
+#include "view/raster/RasterCanvas.hpp"
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace slideEditor::view {
+
+namespace {
+
+// Exact round(x / 255) for x <= 255 * 255 + 127
+inline std::uint32_t div255(std::uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+inline std::uint32_t blend(std::uint32_t dst, std::uint32_t src, std::uint32_t alpha) {
+    std::uint32_t inverse = 255 - alpha;
+    std::uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        std::uint32_t s = (src >> shift) & 0xFF;
+        std::uint32_t d = (dst >> shift) & 0xFF;
+        result |= div255(s * alpha + d * inverse) << shift;
+    }
+
+    return result;
+}
+
+} // namespace
+
+RasterCanvas::RasterCanvas(int width, int height, int originX, int originY)
+    : width_(std::max(width, 0)), height_(std::max(height, 0)),
+      originX_(originX), originY_(originY), stride_(width_), view_(false),
+      pixels_(static_cast<size_t>(width_) * height_, 0), data_(pixels_.data()) {}
+
+RasterCanvas::RasterCanvas(const RasterCanvas& other)
+    : width_(other.width_), height_(other.height_),
+      originX_(other.originX_), originY_(other.originY_),
+      stride_(other.stride_), view_(other.view_), pixels_(other.pixels_),
+      data_(other.view_ ? other.data_ : pixels_.data()) {}
+
+RasterCanvas::RasterCanvas(RasterCanvas&& other) noexcept
+    : width_(other.width_), height_(other.height_),
+      originX_(other.originX_), originY_(other.originY_),
+      stride_(other.stride_), view_(other.view_), pixels_(std::move(other.pixels_)),
+      data_(other.view_ ? other.data_ : pixels_.data()) {}
+
+RasterCanvas& RasterCanvas::operator=(const RasterCanvas& other) {
+    if (this != &other) {
+        RasterCanvas copy(other);
+        *this = std::move(copy);
+    }
+
+    return *this;
+}
+
+RasterCanvas& RasterCanvas::operator=(RasterCanvas&& other) noexcept {
+    width_ = other.width_;
+    height_ = other.height_;
+    originX_ = other.originX_;
+    originY_ = other.originY_;
+    stride_ = other.stride_;
+    view_ = other.view_;
+    pixels_ = std::move(other.pixels_);
+    data_ = view_ ? other.data_ : pixels_.data();
+
+    return *this;
+}
+
+RasterCanvas RasterCanvas::view(RasterCanvas& target, int x, int y, int width, int height) {
+    RasterCanvas window(0, 0, target.originX_ + x, target.originY_ + y);
+    window.width_ = std::max(width, 0);
+    window.height_ = std::max(height, 0);
+    window.stride_ = target.stride_;
+    window.view_ = true;
+    window.data_ = target.row(y) + x;
+
+    return window;
+}
+
+void RasterCanvas::clear(std::uint32_t color) {
+    for (int y = 0; y < height_; ++y) {
+        fillSpan(y, 0, width_, color);
+    }
+}
+
+void RasterCanvas::fillSpan(int y, int x0, int x1, std::uint32_t color) {
+    std::uint32_t* p = row(y) + x0;
+    int count = x1 - x0;
+    int i = 0;
+#if defined(__SSE2__)
+    const __m128i value = _mm_set1_epi32(static_cast<int>(color));
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), value);
+    }
+#endif
+    for (; i < count; ++i) {
+        p[i] = color;
+    }
+}
+
+void RasterCanvas::blendSpan(int y, int x0, int x1, std::uint32_t color, std::uint8_t alpha) {
+    if (alpha == 0) {
+        return;
+    }
+    if (alpha == 255) {
+        fillSpan(y, x0, x1, color);
+        return;
+    }
+
+    std::uint32_t* p = row(y) + x0;
+    int count = x1 - x0;
+    int i = 0;
+#if defined(__SSE2__)
+    // Two pixels per 8 x u16 lane: dst * (255 - a) + src * a + 128, then / 255
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i src = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)), zero);
+    const __m128i srcTerm = _mm_add_epi16(_mm_mullo_epi16(src, _mm_set1_epi16(alpha)),
+                                          _mm_set1_epi16(128));
+    const __m128i inverse = _mm_set1_epi16(static_cast<short>(255 - alpha));
+    for (; i + 4 <= count; i += 4) {
+        __m128i dst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i lo = _mm_unpacklo_epi8(dst, zero);
+        __m128i hi = _mm_unpackhi_epi8(dst, zero);
+        lo = _mm_add_epi16(_mm_mullo_epi16(lo, inverse), srcTerm);
+        hi = _mm_add_epi16(_mm_mullo_epi16(hi, inverse), srcTerm);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < count; ++i) {
+        p[i] = blend(p[i], color, alpha);
+    }
+}
+
+void RasterCanvas::blendPixel(int x, int y, std::uint32_t color, std::uint8_t alpha) {
+    if (alpha == 0) {
+        return;
+    }
+
+    std::uint32_t& pixel = row(y)[x];
+    pixel = alpha == 255 ? color : blend(pixel, color, alpha);
+}
+
+} // namespace slideEditor::view
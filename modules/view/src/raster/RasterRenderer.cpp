@@ -0,0 +1,158 @@
+#include "view/raster/RasterRenderer.hpp"
+#include "view/LayoutEngine.hpp"
+#include "view/SlideLayout.hpp"
+#include "view/raster/TileRenderer.hpp"
+#include "model/shapes/Shape.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace slideEditor::view {
+
+namespace {
+
+constexpr double SHAPE_STROKE_WIDTH = 2.0;
+constexpr double FRAME_MARGIN = 10.0;
+
+std::uint32_t toPixel(const model::Color& color) {
+    return RasterCanvas::packColor(color.r, color.g, color.b, color.a);
+}
+
+} // namespace
+
+std::vector<RasterShape> RasterRenderer::buildScene(const core::ISlideRepository* repository,
+                                                    size_t first, size_t last,
+                                                    LayoutMode layout) {
+    std::vector<RasterShape> scene;
+    if (!repository) {
+        return scene;
+    }
+
+    const auto& slides = repository->getAllSlides();
+    last = std::min(last, slides.size());
+    std::vector<ShapePlacement> placements;
+    int slideNumber = 0;
+    for (size_t i = first; i < last; ++i, ++slideNumber) {
+        // Slide frame, as the SVG <rect x="10" ... fill="white" stroke="#333">
+        const double halfWidth = SlideLayout::SLIDE_WIDTH / 2.0 - FRAME_MARGIN;
+        const double halfHeight = SlideLayout::SLIDE_HEIGHT / 2.0 - FRAME_MARGIN;
+        scene.push_back(RasterShape{
+            core::ShapeType::RECTANGLE,
+            SlideLayout::SLIDE_WIDTH / 2.0,
+            SlideLayout::slideOffsetY(slideNumber) + SlideLayout::SLIDE_HEIGHT / 2.0,
+            halfWidth, halfHeight,
+            RasterCanvas::packColor(0xff, 0xff, 0xff),
+            RasterCanvas::packColor(0x33, 0x33, 0x33),
+            SHAPE_STROKE_WIDTH
+        });
+
+        const auto& shapes = slides[i]->getShapes();
+        if (layout == LayoutMode::PACKED) {
+            LayoutEngine::computePacked(slides[i].get(), placements);
+        }
+        else {
+            LayoutEngine::computeGrid(slides[i].get(), placements);
+        }
+        for (size_t s = 0; s < shapes.size(); ++s) {
+            const auto* shape = dynamic_cast<const model::Shape*>(shapes[s].get());
+            if (!shape) {
+                continue;  // Geometry is only known for model shapes
+            }
+
+            RasterShape raster{};
+            raster.type = shape->getType();
+            raster.cx = placements[s].x;
+            raster.cy = SlideLayout::slideOffsetY(slideNumber) + placements[s].y;
+            raster.fill = toPixel(shape->getFillColorValue());
+            raster.stroke = toPixel(shape->getBorderColorValue());
+            raster.strokeWidth = SHAPE_STROKE_WIDTH * placements[s].scale;
+            switch (raster.type) {
+                case core::ShapeType::CIRCLE:
+                    raster.rx = raster.ry = shape->getCircleRadius();
+                    break;
+                case core::ShapeType::RECTANGLE:
+                    raster.rx = shape->getRectangleWidth() / 2.0;
+                    raster.ry = shape->getRectangleHeight() / 2.0;
+                    break;
+                case core::ShapeType::TRIANGLE:
+                    raster.rx = shape->getTriangleSide() / 2.0;
+                    raster.ry = shape->getTriangleSide() * std::sqrt(3.0) / 2.0;
+                    break;
+                case core::ShapeType::ELLIPSE:
+                    raster.rx = shape->getEllipseRadiusX();
+                    raster.ry = shape->getEllipseRadiusY();
+                    break;
+            }
+            // Shrunk packed shapes, scaled around their anchor as in SVG
+            raster.rx *= placements[s].scale;
+            raster.ry *= placements[s].scale;
+
+            scene.push_back(raster);
+        }
+    }
+
+    return scene;
+}
+
+int RasterRenderer::canvasWidth() {
+    return SlideLayout::SLIDE_WIDTH;
+}
+
+int RasterRenderer::canvasHeight(size_t slideCount) {
+    return slideCount == 0 ? SlideLayout::SLIDE_HEIGHT
+                           : static_cast<int>(slideCount) * SlideLayout::SLIDE_PITCH;
+}
+
+RasterCanvas RasterRenderer::render(const core::ISlideRepository* repository,
+                                    size_t first, size_t last, LayoutMode layout) {
+    size_t count = 0;
+    if (repository) {
+        last = std::min(last, repository->getSlideCount());
+        count = first < last ? last - first : 0;
+    }
+
+    RasterCanvas canvas(canvasWidth(), canvasHeight(count));
+    canvas.clear(BACKGROUND);
+    if (count > 0) {
+        drawScene(canvas, buildScene(repository, first, last, layout));
+    }
+
+    return canvas;
+}
+
+void RasterRenderer::drawScene(RasterCanvas& canvas, const std::vector<RasterShape>& scene) {
+    for (const auto& shape : scene) {
+        Rasterizer::draw(canvas, shape);
+    }
+}
+
+bool RasterRenderer::renderToFile(const core::ISlideRepository* repository,
+                                  const std::string& filename, ImageFormat format,
+                                  size_t first, size_t last, LayoutMode layout,
+                                  WorkStealingPool* pool) {
+    if (!repository) {
+        return false;
+    }
+
+    last = std::min(last, repository->getSlideCount());
+    const size_t count = first < last ? last - first : 0;
+    const int width = canvasWidth();
+    const int height = canvasHeight(count);
+
+    ImageWriter writer;
+    if (!writer.open(filename, format, width, height)) {
+        return false;
+    }
+
+    std::vector<RasterShape> scene;
+    if (count > 0) {
+        scene = buildScene(repository, first, last, layout);
+    }
+
+    bool rendered = TileRenderer::renderToWriter(scene, width, height, BACKGROUND, writer,
+                                                 pool ? *pool : WorkStealingPool::shared());
+    bool closed = writer.close();
+
+    return rendered && closed;
+}
+
+} // namespace slideEditor::view
@@ -0,0 +1,240 @@
+#include "view/raster/Rasterizer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace slideEditor::view {
+
+namespace {
+
+inline double clamp01(double value) {
+    return std::min(1.0, std::max(0.0, value));
+}
+
+inline std::uint8_t scaleAlpha(double coverage, std::uint8_t alpha) {
+    return static_cast<std::uint8_t>(coverage * alpha + 0.5);
+}
+
+// Triangle vertices: apex, bottom-left, bottom-right
+inline void triangleVertices(const RasterShape& s, double (&v)[3][2]) {
+    v[0][0] = s.cx;        v[0][1] = s.cy - s.ry * 2.0 / 3.0;
+    v[1][0] = s.cx - s.rx; v[1][1] = s.cy + s.ry / 3.0;
+    v[2][0] = s.cx + s.rx; v[2][1] = s.cy + s.ry / 3.0;
+}
+
+} // namespace
+
+void Rasterizer::verticalExtent(const RasterShape& shape, double& top, double& bottom,
+                                double& widest) {
+    if (shape.type == core::ShapeType::TRIANGLE) {
+        top = shape.cy - shape.ry * 2.0 / 3.0;
+        bottom = shape.cy + shape.ry / 3.0;
+        widest = bottom;
+        return;
+    }
+
+    top = shape.cy - shape.ry;
+    bottom = shape.cy + shape.ry;
+    widest = shape.cy;
+}
+
+RasterBounds Rasterizer::bounds(const RasterShape& shape) {
+    double margin = shape.strokeWidth / 2.0 + 1.0;
+    double top = 0;
+    double bottom = 0;
+    double widest = 0;
+    verticalExtent(shape, top, bottom, widest);
+
+    return RasterBounds{shape.cx - shape.rx - margin, top - margin,
+                        shape.cx + shape.rx + margin, bottom + margin};
+}
+
+double Rasterizer::signedDistance(const RasterShape& shape, double x, double y) {
+    double dx = x - shape.cx;
+    double dy = y - shape.cy;
+    switch (shape.type) {
+        case core::ShapeType::CIRCLE:
+            return std::sqrt(dx * dx + dy * dy) - shape.rx;
+        
+        case core::ShapeType::RECTANGLE: {
+            double qx = std::abs(dx) - shape.rx;
+            double qy = std::abs(dy) - shape.ry;
+            double ox = std::max(qx, 0.0);
+            double oy = std::max(qy, 0.0);
+
+            return std::sqrt(ox * ox + oy * oy) + std::min(std::max(qx, qy), 0.0);
+        }
+        
+        case core::ShapeType::ELLIPSE: {
+            // First-order estimate: (k - 1) / |grad k| with k = |(dx/rx, dy/ry)|
+            double ux = dx / shape.rx;
+            double uy = dy / shape.ry;
+            double k = std::sqrt(ux * ux + uy * uy);
+            double gx = ux / shape.rx;
+            double gy = uy / shape.ry;
+            double gradient = std::sqrt(gx * gx + gy * gy);
+            if (k < 1e-9 || gradient < 1e-12) {
+                return -std::min(shape.rx, shape.ry);
+            }
+
+            return (k - 1.0) * k / gradient;
+        }
+        
+        case core::ShapeType::TRIANGLE: {
+            // Max of the edge-line distances (exact inside, slightly rounded at corners)
+            double v[3][2];
+            triangleVertices(shape, v);
+            double distance = -1e300;
+            for (int i = 0; i < 3; ++i) {
+                const double* a = v[i];
+                const double* b = v[(i + 1) % 3];
+                double ex = b[0] - a[0];
+                double ey = b[1] - a[1];
+                double length = std::sqrt(ex * ex + ey * ey);
+                // Vertices run counter-clockwise on screen, so (-ey, ex) points outward
+                double nx = -ey / length;
+                double ny = ex / length;
+                distance = std::max(distance, (x - a[0]) * nx + (y - a[1]) * ny);
+            }
+
+            return distance;
+        }
+    }
+
+    return 1e300;
+}
+
+bool Rasterizer::rowInterval(const RasterShape& shape, double y, double& x0, double& x1) {
+    double dy = y - shape.cy;
+    double half = 0;
+    switch (shape.type) {
+        case core::ShapeType::CIRCLE:
+            if (std::abs(dy) > shape.rx) return false;
+            half = std::sqrt(shape.rx * shape.rx - dy * dy);
+            break;
+        
+        case core::ShapeType::RECTANGLE:
+            if (std::abs(dy) > shape.ry) return false;
+            half = shape.rx;
+            break;
+        
+        case core::ShapeType::ELLIPSE: {
+            double t = dy / shape.ry;
+            if (std::abs(t) > 1.0) return false;
+            half = shape.rx * std::sqrt(1.0 - t * t);
+            break;
+        }
+        
+        case core::ShapeType::TRIANGLE: {
+            double apex = shape.cy - shape.ry * 2.0 / 3.0;
+            double t = (y - apex) / shape.ry;
+            if (t < 0.0 || t > 1.0) return false;
+            half = t * shape.rx;
+            break;
+        }
+    }
+
+    x0 = shape.cx - half;
+    x1 = shape.cx + half;
+    return true;
+}
+
+void Rasterizer::draw(RasterCanvas& canvas, const RasterShape& shape) {
+    const int originX = canvas.getOriginX();
+    const int originY = canvas.getOriginY();
+    const RasterBounds box = bounds(shape);
+    const int rowBegin = std::max(static_cast<int>(std::floor(box.top)) - originY, 0);
+    const int rowEnd = std::min(static_cast<int>(std::ceil(box.bottom)) - originY, canvas.getHeight());
+    const int colBegin = std::max(static_cast<int>(std::floor(box.left)) - originX, 0);
+    const int colEnd = std::min(static_cast<int>(std::ceil(box.right)) - originX, canvas.getWidth());
+    if (rowBegin >= rowEnd || colBegin >= colEnd) {
+        return;
+    }
+
+    const double halfStroke = shape.strokeWidth / 2.0;
+    const std::uint8_t fillAlpha = RasterCanvas::alpha(shape.fill);
+    const std::uint8_t strokeAlpha = halfStroke > 0 ? RasterCanvas::alpha(shape.stroke) : 0;
+    // A pixel whose center is this far inside gets full fill and no stroke
+    const double inset = halfStroke + 0.5;
+
+    auto shadeEdge = [&](int px, int py, double gx, double gy) {
+        double distance = signedDistance(shape, gx, gy);
+        if (distance >= inset) {
+            return;
+        }
+
+        canvas.blendPixel(px, py, shape.fill, scaleAlpha(clamp01(0.5 - distance), fillAlpha));
+        if (strokeAlpha) {
+            double coverage = clamp01(inset - std::abs(distance));
+            canvas.blendPixel(px, py, shape.stroke, scaleAlpha(coverage, strokeAlpha));
+        }
+    };
+
+    double shapeTop = 0;
+    double shapeBottom = 0;
+    double widestRow = 0;
+    verticalExtent(shape, shapeTop, shapeBottom, widestRow);
+
+    for (int py = rowBegin; py < rowEnd; ++py) {
+        const double gy = py + originY + 0.5;
+        // Outer run: only points within `inset` of the shape get any coverage.
+        // Row extents are concave in y, so sampling the band ends (clamped to the
+        // shape) and the widest row bounds every row in between.
+        const double bandTop = std::max(gy - inset, shapeTop);
+        const double bandBottom = std::min(gy + inset, shapeBottom);
+        if (bandTop > bandBottom) {
+            continue;
+        }
+
+        double outerLeft = 1e300;
+        double outerRight = -1e300;
+        const double samples[3] = {bandTop, bandBottom, std::clamp(widestRow, bandTop, bandBottom)};
+        for (double sampleY : samples) {
+            double s0, s1;
+            if (rowInterval(shape, sampleY, s0, s1)) {
+                outerLeft = std::min(outerLeft, s0);
+                outerRight = std::max(outerRight, s1);
+            }
+        }
+
+        if (outerLeft > outerRight) {
+            continue;
+        }
+
+        const int outerBegin = std::max(static_cast<int>(std::floor(outerLeft - inset)) - originX, colBegin);
+        const int outerEnd = std::min(static_cast<int>(std::ceil(outerRight + inset)) - originX, colEnd);
+        if (outerBegin >= outerEnd) {
+            continue;
+        }
+
+        // Interior run: the square of half-size `inset` around every center is
+        // inside the (convex) shape, so it is enough to test the rows above and below
+        int innerBegin = outerEnd;
+        int innerEnd = outerEnd;
+        double a0, a1, b0, b1;
+        if (rowInterval(shape, gy - inset, a0, a1) && rowInterval(shape, gy + inset, b0, b1)) {
+            double left = std::max(a0, b0) + inset;
+            double right = std::min(a1, b1) - inset;
+            if (left <= right) {
+                int first = static_cast<int>(std::ceil(left - 0.5)) - originX;
+                int last = static_cast<int>(std::floor(right - 0.5)) - originX + 1;
+                first = std::clamp(first, outerBegin, outerEnd);
+                last = std::clamp(last, first, outerEnd);
+                if (first < last) {
+                    innerBegin = first;
+                    innerEnd = last;
+                }
+            }
+        }
+
+        for (int px = outerBegin; px < innerBegin; ++px) {
+            shadeEdge(px, py, px + originX + 0.5, gy);
+        }
+
+        canvas.blendSpan(py, innerBegin, innerEnd, shape.fill, fillAlpha);
+        for (int px = innerEnd; px < outerEnd; ++px) {
+            shadeEdge(px, py, px + originX + 0.5, gy);
+        }
+    }
+}
+
+} // namespace slideEditor::view
@@ -0,0 +1,106 @@
+#include "view/raster/TileRenderer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace slideEditor::view {
+
+namespace {
+
+// Tiles in flight per worker; enough slack for stealing to balance uneven tiles
+constexpr size_t TILES_PER_THREAD = 4;
+
+} // namespace
+
+TileBins TileRenderer::binShapes(const std::vector<RasterShape>& scene, int width, int height,
+                                 int tileSize) {
+    TileBins bins;
+    bins.tileSize = std::max(tileSize, 1);
+    bins.columns = (std::max(width, 0) + bins.tileSize - 1) / bins.tileSize;
+    bins.rows = (std::max(height, 0) + bins.tileSize - 1) / bins.tileSize;
+    bins.shapes.resize(static_cast<size_t>(bins.columns) * bins.rows);
+
+    for (size_t i = 0; i < scene.size(); ++i) {
+        const RasterBounds box = Rasterizer::bounds(scene[i]);
+        int firstColumn = std::max(static_cast<int>(std::floor(box.left)) / bins.tileSize, 0);
+        int lastColumn = std::min(static_cast<int>(std::ceil(box.right)) / bins.tileSize, bins.columns - 1);
+        int firstRow = std::max(static_cast<int>(std::floor(box.top)) / bins.tileSize, 0);
+        int lastRow = std::min(static_cast<int>(std::ceil(box.bottom)) / bins.tileSize, bins.rows - 1);
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                bins.shapes[static_cast<size_t>(row) * bins.columns + column]
+                    .push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    return bins;
+}
+
+void TileRenderer::renderTile(const std::vector<RasterShape>& scene, const TileBins& bins,
+                              int column, int row, std::uint32_t background, RasterCanvas& tile) {
+    tile.clear(background);
+    for (std::uint32_t index : bins.at(column, row)) {
+        Rasterizer::draw(tile, scene[index]);
+    }
+}
+
+void TileRenderer::renderBand(const std::vector<RasterShape>& scene, const TileBins& bins,
+                              int firstRow, int rowCount, std::uint32_t background,
+                              RasterCanvas& band, WorkStealingPool& pool) {
+    const int tileSize = bins.tileSize;
+    const size_t tileCount = static_cast<size_t>(rowCount) * bins.columns;
+    pool.parallelFor(tileCount, [&](size_t t) {
+        const int row = firstRow + static_cast<int>(t / bins.columns);
+        const int column = static_cast<int>(t % bins.columns);
+        const int x0 = column * tileSize;
+        const int y0 = row * tileSize;
+        const int width = std::min(tileSize, band.getWidth() - x0);
+        const int height = std::min(tileSize, band.getOriginY() + band.getHeight() - y0);
+
+        // Tiles are disjoint windows of the band, so workers never share pixels
+        RasterCanvas tile = RasterCanvas::view(band, x0, y0 - band.getOriginY(), width, height);
+        renderTile(scene, bins, column, row, background, tile);
+    });
+}
+
+RasterCanvas TileRenderer::render(const std::vector<RasterShape>& scene, int width, int height,
+                                  std::uint32_t background, WorkStealingPool& pool, int tileSize) {
+    RasterCanvas canvas(width, height);
+    TileBins bins = binShapes(scene, width, height, tileSize);
+    renderBand(scene, bins, 0, bins.rows, background, canvas, pool);
+
+    return canvas;
+}
+
+bool TileRenderer::renderToWriter(const std::vector<RasterShape>& scene, int width, int height,
+                                  std::uint32_t background, ImageWriter& writer,
+                                  WorkStealingPool& pool, int tileSize) {
+    TileBins bins = binShapes(scene, width, height, tileSize);
+    if (bins.columns == 0 || bins.rows == 0) {
+        return false;
+    }
+
+    // Band height in tile rows: enough tiles to keep every worker busy
+    const size_t wanted = TILES_PER_THREAD * (pool.getThreadCount() + 1);
+    const int bandRows = static_cast<int>(std::max<size_t>(1, wanted / bins.columns));
+    RasterCanvas band(width, std::min(bandRows * bins.tileSize, height));
+
+    for (int firstRow = 0; firstRow < bins.rows; firstRow += bandRows) {
+        const int rowCount = std::min(bandRows, bins.rows - firstRow);
+        const int y0 = firstRow * bins.tileSize;
+        const int bandHeight = std::min(rowCount * bins.tileSize, height - y0);
+        if (band.getHeight() != bandHeight) {
+            band = RasterCanvas(width, bandHeight);  // Last, shorter band
+        }
+
+        band.setOrigin(0, y0);
+        renderBand(scene, bins, firstRow, rowCount, background, band, pool);
+        if (!writer.writeRows(band)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace slideEditor::view
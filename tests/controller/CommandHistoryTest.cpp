@@ -134,4 +134,82 @@ TEST_F(CommandHistoryTest, MaxHistorySize_LimitsStack) {
     limitedHistory.pushAction(createTestCommand());
     
     EXPECT_EQ(limitedHistory.getUndoableActionCount(), 2);
-}
\ No newline at end of file
+}
+
+TEST_F(CommandHistoryTest, CommitGroup_PushesOneEntry) {
+    EXPECT_TRUE(history_->beginGroup());
+    EXPECT_FALSE(history_->beginGroup());  // No nesting
+    for (int i = 0; i < 50; ++i) {
+        history_->pushAction(createTestCommand());
+    }
+    EXPECT_EQ(history_->getGroupSize(), 50);
+    EXPECT_EQ(history_->getUndoableActionCount(), 0);
+    
+    EXPECT_EQ(history_->commitGroup(), 50);
+    
+    EXPECT_FALSE(history_->isGroupOpen());
+    EXPECT_EQ(history_->getUndoableActionCount(), 1);
+    EXPECT_EQ(history_->getLastActionToUndo(), "Group of 50 actions");
+}
+
+TEST_F(CommandHistoryTest, UndoGroup_UndoesAllActionsAndRedoReappliesThem) {
+    history_->beginGroup();
+    for (int i = 0; i < 5; ++i) {
+        history_->pushAction(createTestCommand());
+    }
+    history_->commitGroup();
+    ASSERT_EQ(repository_->getSlideCount(), 5);
+    
+    EXPECT_TRUE(history_->undoLastAction());
+    EXPECT_EQ(repository_->getSlideCount(), 0);
+    
+    EXPECT_TRUE(history_->redoLastAction());
+    EXPECT_EQ(repository_->getSlideCount(), 5);
+}
+
+TEST_F(CommandHistoryTest, UndoGroup_PartialFailure_ReappliesUndoneActions) {
+    io::OutputStream output;
+    history_->beginGroup();
+    history_->pushAction(createTestCommand());
+    auto addShape = std::make_unique<UndoableAddShapeCommand>(
+        repository_, 1, "circle", 1.0, "black", "white");
+    addShape->execute(output);
+    history_->pushAction(std::move(addShape));
+    history_->pushAction(createTestCommand());
+    history_->commitGroup();
+    
+    // The shape's undo fails once the last create has already been undone
+    repository_->getSlide(1)->removeShape(0);
+    
+    EXPECT_FALSE(history_->undoLastAction());
+    EXPECT_EQ(repository_->getSlideCount(), 2);
+}
+
+TEST_F(CommandHistoryTest, RollbackGroup_UndoesActionsWithoutEntry) {
+    history_->pushAction(createTestCommand());
+    history_->beginGroup();
+    history_->pushAction(createTestCommand());
+    history_->pushAction(createTestCommand());
+    ASSERT_EQ(repository_->getSlideCount(), 3);
+    
+    EXPECT_EQ(history_->rollbackGroup(), 2);
+    
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+    EXPECT_EQ(history_->getUndoableActionCount(), 1);
+    EXPECT_FALSE(history_->isGroupOpen());
+}
+
+TEST_F(CommandHistoryTest, UndoLastAction_RefusedWhileGroupOpen) {
+    history_->pushAction(createTestCommand());
+    history_->beginGroup();
+    
+    EXPECT_FALSE(history_->undoLastAction());
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+}
+
+TEST_F(CommandHistoryTest, CommitGroup_EmptyGroup_PushesNothing) {
+    history_->beginGroup();
+    
+    EXPECT_EQ(history_->commitGroup(), 0);
+    EXPECT_EQ(history_->getUndoableActionCount(), 0);
+}
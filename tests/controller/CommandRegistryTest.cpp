@@ -12,7 +12,7 @@ protected:
     void SetUp() override {}
     
     std::unique_ptr<IMetaCommand> createTestMetaCommand(const std::string& name) {
-        auto creator = [](const std::vector<std::string>&, void*) -> std::unique_ptr<ICommand> {
+        auto creator = [](ArgumentSpan, void*) -> std::unique_ptr<ICommand> {
             return nullptr;
         };
         
@@ -69,7 +69,7 @@ TEST_F(CommandRegistryTest, GetAllCommandNames_ReturnsNames) {
 }
 
 TEST_F(CommandRegistryTest, GetCommandsByCategory_FiltersCorrectly) {
-    auto creator = [](const std::vector<std::string>&, void*) -> std::unique_ptr<ICommand> {
+    auto creator = [](ArgumentSpan, void*) -> std::unique_ptr<ICommand> {
         return nullptr;
     };
     
@@ -105,4 +105,24 @@ TEST_F(CommandRegistryTest, GetAllCommandsHelp_ReturnsFormattedHelp) {
     
     EXPECT_NE(help.find("cmd1"), std::string::npos);
     EXPECT_NE(help.find("cmd2"), std::string::npos);
-}
\ No newline at end of file
+}
+
+TEST_F(CommandRegistryTest, GetMetaCommand_ResolvesKeywordsCaseInsensitively) {
+    registry_.registerCommand(createTestMetaCommand("addshape"));
+    
+    const auto* metaCmd = registry_.getMetaCommand("AddShape");
+    
+    ASSERT_NE(metaCmd, nullptr);
+    EXPECT_EQ(metaCmd, registry_.getMetaCommand("addshape"));
+    EXPECT_EQ(registry_.getMetaCommand("create"), nullptr);  // Keyword, not registered
+}
+
+TEST_F(CommandRegistryTest, RegisterCommand_ReplacesKeywordCommand) {
+    registry_.registerCommand(createTestMetaCommand("undo"));
+    auto replacement = createTestMetaCommand("UNDO");
+    const auto* expected = replacement.get();
+    registry_.registerCommand(std::move(replacement));
+    
+    EXPECT_EQ(registry_.getMetaCommand("undo"), expected);
+    EXPECT_EQ(registry_.getAllCommandNames().size(), 1);
+}
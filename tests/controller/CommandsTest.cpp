@@ -9,6 +9,7 @@
 #include <memory>
 #include <sstream>
 #include <fstream>
+#include <filesystem>
 
 using namespace slideEditor::controller;
 using namespace slideEditor;
@@ -155,4 +156,147 @@ TEST_F(CommandsTest, ExitCommand_AlwaysSucceeds) {
     bool success = cmd.execute(output_);
     
     EXPECT_TRUE(success);
-}
\ No newline at end of file
+}
+
+TEST_F(CommandsTest, DrawCommand_InvalidRange_Fails) {
+    repository_->addSlide(model::SlideFactory::createSlide(0, "Title", "Content", "Theme"));
+    DrawCommand cmd(repository_, view_, "test_range", nullptr, view::SvgOptions(), 1, 3);
+    
+    bool success = cmd.execute(output_);
+    
+    EXPECT_FALSE(success);
+    EXPECT_NE(cmd.getResultMessage().find("Invalid slide range"), std::string::npos);
+}
+
+TEST_F(CommandsTest, DrawCommand_WritesAllOutputThroughResult) {
+    repository_->addSlide(model::SlideFactory::createSlide(0, "Title", "Content", "Theme"));
+    std::ostringstream text;
+    io::OutputStream output(text);
+    DrawCommand cmd(repository_, view_, "test_draw_output", nullptr, view::SvgOptions(), 0, 0,
+                    nullptr, false);
+    
+    EXPECT_TRUE(cmd.execute(output));
+    EXPECT_EQ(text.str(), "SVG file generated: test_draw_output.svg\n"
+                          "SVG generated: test_draw_output.svg (live preview is running)\n");
+    
+    // Quiet output gets nothing from a successful draw
+    text.str("");
+    output.setVerbosity(core::Verbosity::QUIET);
+    EXPECT_TRUE(cmd.execute(output));
+    EXPECT_EQ(text.str(), "");
+    std::remove("test_draw_output.svg");
+}
+
+TEST_F(CommandsTest, DrawPagesCommand_WritesOneFilePerPage) {
+    for (int i = 0; i < 5; ++i) {
+        repository_->addSlide(model::SlideFactory::createSlide(0, "Title", "Content", "Theme"));
+    }
+    
+    DrawPagesCommand cmd(repository_, "test_pages.svg", 2);
+    bool success = cmd.execute(output_);
+    
+    EXPECT_TRUE(success);
+    for (size_t page = 1; page <= 3; ++page) {
+        std::string filename = DrawPagesCommand::pageFilename("test_pages", page);
+        std::ifstream file(filename);
+        EXPECT_TRUE(file.good()) << filename;
+        file.close();
+        std::remove(filename.c_str());
+    }
+    
+    std::ifstream extra(DrawPagesCommand::pageFilename("test_pages", 4));
+    EXPECT_FALSE(extra.good());
+}
+
+TEST_F(CommandsTest, DrawPagesCommand_ZeroPageSize_Fails) {
+    DrawPagesCommand cmd(repository_, "test_pages", 0);
+    
+    EXPECT_FALSE(cmd.execute(output_));
+}
+
+TEST_F(CommandsTest, DrawSplitCommand_WritesSlidesAndIndex) {
+    int id = repository_->addSlide(model::SlideFactory::createSlide(0, "Title", "Content", "Theme"));
+    auto exporter = std::make_shared<view::SplitExporter>();
+    
+    DrawSplitCommand first(repository_, exporter, "test_split");
+    EXPECT_TRUE(first.execute(output_));
+    EXPECT_NE(first.getResultMessage().find("1 written"), std::string::npos);
+    EXPECT_TRUE(std::filesystem::exists("test_split/index.html"));
+    EXPECT_TRUE(std::filesystem::exists("test_split/" + view::SplitExporter::slideFilename(id)));
+    
+    DrawSplitCommand second(repository_, exporter, "test_split");
+    EXPECT_TRUE(second.execute(output_));
+    EXPECT_NE(second.getResultMessage().find("0 written, 1 unchanged"), std::string::npos);
+    
+    std::filesystem::remove_all("test_split");
+}
+
+TEST_F(CommandsTest, PreviewCommand_StartsServerAndPublishes) {
+    repository_->addSlide(model::SlideFactory::createSlide(0, "Title", "Content", "Theme"));
+    auto server = std::make_shared<view::PreviewServer>();
+    
+    PreviewCommand cmd(repository_, server, 0);
+    bool success = cmd.execute(output_);
+#ifndef _WIN32
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(server->isRunning());
+    EXPECT_NE(cmd.getResultMessage().find(server->getUrl()), std::string::npos);
+    EXPECT_EQ(server->publish(repository_.get()), 0u);  // Already published
+#else
+    EXPECT_FALSE(success);
+#endif
+    server->stop();
+}
+
+TEST_F(CommandsTest, PreviewCommand_InvalidPort_Fails) {
+    PreviewCommand cmd(repository_, std::make_shared<view::PreviewServer>(), 70000);
+    
+    EXPECT_FALSE(cmd.execute(output_));
+}
+
+TEST_F(CommandsTest, ExportCommand_WritesImageWithExtension) {
+    repository_->addSlide(model::SlideFactory::createSlide(0, "Title", "Content", "Theme"));
+    ExportCommand cmd(repository_, "test_export", view::ImageFormat::PPM);
+    
+    bool success = cmd.execute(output_);
+    
+    EXPECT_TRUE(success);
+    std::ifstream file("test_export.ppm");
+    EXPECT_TRUE(file.good());
+    file.close();
+    std::remove("test_export.ppm");
+}
+
+TEST_F(CommandsTest, ExportCommand_InvalidRange_Fails) {
+    ExportCommand cmd(repository_, "test_export", view::ImageFormat::PNG, 2, 1);
+    
+    EXPECT_FALSE(cmd.execute(output_));
+}
+
+TEST_F(CommandsTest, QuietOutput_SkipsSuccessButKeepsResult) {
+    output_.setVerbosity(core::Verbosity::QUIET);
+    UndoableCreateCommand cmd(repository_, "Title", "Content", "Theme");
+    
+    EXPECT_TRUE(cmd.execute(output_));
+    EXPECT_EQ(output_.getOutput(), "");
+    EXPECT_EQ(cmd.getResultMessage(), "[ACTION] Slide created successfully with ID: 1");
+    
+    cmd.undo();
+    EXPECT_EQ(cmd.getResultMessage(), "[UNDO ACTION] Removed slide 1");
+}
+
+TEST_F(CommandsTest, QuietOutput_StillWritesErrors) {
+    output_.setVerbosity(core::Verbosity::QUIET);
+    UndoableAddShapeCommand cmd(repository_, 42, "circle", 1.0);
+    
+    EXPECT_FALSE(cmd.execute(output_));
+    EXPECT_EQ(output_.getOutput(), "[ERROR] Error: Slide with ID 42 not found\n");
+}
+
+TEST_F(CommandsTest, NormalOutput_WritesRenderedResult) {
+    auto options = std::make_shared<view::SvgOptions>();
+    SvgModeCommand cmd(options, "plain");
+    
+    EXPECT_TRUE(cmd.execute(output_));
+    EXPECT_EQ(output_.getOutput(), "SVG output mode set to plain\n");
+}
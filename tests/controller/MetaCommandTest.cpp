@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
 #include "controller/MetaCommand.hpp"
+#include "controller/commands/Commands.hpp"
+#include "controller/commands/UndoableCommands.hpp"
 #include "interfaces/ICommand.hpp"
+#include "io/OutputStream.hpp"
+#include "model/SlideRepository.hpp"
 
 #include <memory>
 #include <string>
@@ -9,6 +13,8 @@
 
 using slideEditor::controller::MetaCommand;
 using slideEditor::core::ArgumentInfo;
+using slideEditor::core::ArgumentSpan;
+using slideEditor::core::CommandArgument;
 using slideEditor::core::CommandCreator;
 using slideEditor::core::ICommand;
 
@@ -19,7 +25,7 @@ std::unique_ptr<MetaCommand> makeMetaCommand(
     std::initializer_list<ArgumentInfo> arguments = {}) {
 
     if (!creator) {
-        creator = [](const std::vector<std::string>&, void*) {
+        creator = [](ArgumentSpan, void*) {
             return std::unique_ptr<ICommand>();
         };
     }
@@ -39,7 +45,7 @@ class MetaCommandTest : public ::testing::Test {};
 TEST_F(MetaCommandTest, ProvidesMetadataAndCallableCreator) {
     bool invoked = false;
     auto meta = makeMetaCommand(
-        [&invoked](const std::vector<std::string>& args, void*) {
+        [&invoked](ArgumentSpan args, void*) {
             invoked = true;
             EXPECT_TRUE(args.empty());
             return std::unique_ptr<ICommand>();
@@ -106,4 +112,105 @@ TEST_F(MetaCommandTest, DetailedHelpIncludesArgumentsAndCategory) {
     EXPECT_NE(help.find("create <title> <id>"), std::string::npos);
     EXPECT_NE(help.find("Slide title"), std::string::npos);
     EXPECT_NE(help.find("Category: ACTION"), std::string::npos);
-}
\ No newline at end of file
+}
+
+TEST_F(MetaCommandTest, ValidateParsedArgumentsChecksCountAndTypes) {
+    auto meta = makeMetaCommand(
+        CommandCreator{},
+        { ArgumentInfo{"id", "int", "Slide identifier"},
+          ArgumentInfo{"scale", "double", "Scaling factor", false} });
+    const std::vector<CommandArgument> valid = {CommandArgument(5), CommandArgument(1.25)};
+    const std::vector<CommandArgument> wholeScale = {CommandArgument(5), CommandArgument(2)};
+    const std::vector<CommandArgument> wrongType = {CommandArgument(std::string("five"))};
+    const std::vector<CommandArgument> tooMany = {CommandArgument(5), CommandArgument(1.0),
+                                                  CommandArgument(3)};
+
+    EXPECT_TRUE(meta->validateParsedArguments(valid));
+    EXPECT_TRUE(meta->validateParsedArguments(wholeScale));
+    EXPECT_FALSE(meta->validateParsedArguments(ArgumentSpan()));  // missing required
+    EXPECT_FALSE(meta->validateParsedArguments(wrongType));
+    EXPECT_FALSE(meta->validateParsedArguments(tooMany));
+}
+
+TEST_F(MetaCommandTest, CreatorReceivesTypedArguments) {
+    int id = 0;
+    double scale = 0;
+    auto meta = makeMetaCommand(
+        [&](ArgumentSpan args, void*) {
+            id = args[0].asInt();
+            scale = args[1].asDouble();
+            return std::unique_ptr<ICommand>();
+        });
+    const std::vector<CommandArgument> args = {CommandArgument(7), CommandArgument(0.5)};
+
+    meta->getCreator()(args, nullptr);
+
+    EXPECT_EQ(id, 7);
+    EXPECT_DOUBLE_EQ(scale, 0.5);
+}
+
+static_assert(slideEditor::controller::CommandTraits<
+                  slideEditor::controller::UndoableCreateCommand>::isUndoable,
+              "undoable commands are recognised at compile time");
+static_assert(!slideEditor::controller::CommandTraits<
+                  slideEditor::controller::ExitCommand>::isUndoable,
+              "plain commands are not undoable");
+
+TEST_F(MetaCommandTest, CreateTyped_InvokerRunsAndRecordsActions) {
+    using namespace slideEditor;
+    auto repository = std::make_shared<model::SlideRepository>();
+    controller::CommandContext context;
+    context.setRepository(repository);
+    controller::CommandHistory history;
+    io::OutputStream output;
+    
+    auto meta = MetaCommand::create<controller::UndoableCreateCommand>(
+        "create", "Create a new slide", "ACTION",
+        [](ArgumentSpan args, controller::CommandContext& ctx) {
+            return controller::UndoableCreateCommand(ctx.getRepository(), args[0].asString(),
+                                                     args[1].asString(), args[2].asString());
+        },
+        {{"title", "identifier", "Title"}, {"content", "identifier", "Content"},
+         {"theme", "identifier", "Theme"}});
+    const auto* invoker = meta->getInvoker();
+    ASSERT_NE(invoker, nullptr);
+    EXPECT_TRUE(invoker->isAction());
+    
+    const std::vector<CommandArgument> args = {
+        CommandArgument(std::string("T")), CommandArgument(std::string("C")),
+        CommandArgument(std::string("D"))};
+    EXPECT_TRUE(invoker->invoke(args, context, output, history));
+    
+    EXPECT_EQ(repository->getSlideCount(), 1);
+    EXPECT_EQ(history.getUndoableActionCount(), 1);
+    
+    // The legacy creator is built from the same factory
+    auto command = meta->getCreator()(args, &context);
+    ASSERT_NE(command, nullptr);
+    EXPECT_TRUE(command->isAction());
+}
+
+TEST_F(MetaCommandTest, CreateTyped_FailureReportsMessageAndSkipsHistory) {
+    using namespace slideEditor;
+    controller::CommandContext context;
+    context.setRepository(std::make_shared<model::SlideRepository>());
+    controller::CommandHistory history;
+    io::OutputStream output;
+    
+    auto meta = MetaCommand::create<controller::UndoableRemoveShapeCommand>(
+        "removeshape", "Remove a shape", "ACTION",
+        [](ArgumentSpan args, controller::CommandContext& ctx) {
+            return controller::UndoableRemoveShapeCommand(ctx.getRepository(), args[0].asInt(), 0);
+        });
+    
+    const std::vector<CommandArgument> args = {CommandArgument(9)};
+    std::string failure;
+    EXPECT_FALSE(meta->getInvoker()->invoke(args, context, output, history, &failure));
+    
+    EXPECT_NE(failure.find("not found"), std::string::npos);
+    EXPECT_EQ(history.getUndoableActionCount(), 0);
+}
+
+TEST_F(MetaCommandTest, PlainMetaCommand_HasNoInvoker) {
+    EXPECT_EQ(makeMetaCommand()->getInvoker(), nullptr);
+}
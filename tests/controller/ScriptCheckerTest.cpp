@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include "controller/ScriptChecker.hpp"
+#include "controller/CommandRegistry.hpp"
+#include "controller/commands/MetaCommandDefinitions.hpp"
+#include <string>
+
+using namespace slideEditor::controller;
+using namespace slideEditor;
+
+class ScriptCheckerTest : public ::testing::Test {
+protected:
+    CommandRegistry registry_;
+    view::WorkStealingPool pool_{4};
+    
+    void SetUp() override {
+        registry_.registerCommand(createCreateMetaCommand());
+        registry_.registerCommand(createAddShapeMetaCommand());
+        registry_.registerCommand(createExitMetaCommand());
+    }
+};
+
+TEST_F(ScriptCheckerTest, SplitChunks_EndAtNewlines) {
+    const std::string script = "aaaa\nbb\ncccccc\nd";
+    
+    auto chunks = ScriptChecker::splitChunks(script, 3);
+    
+    ASSERT_EQ(chunks.size(), 4);
+    EXPECT_EQ(chunks[0], "aaaa\n");
+    EXPECT_EQ(chunks[1], "bb\n");
+    EXPECT_EQ(chunks[2], "cccccc\n");
+    EXPECT_EQ(chunks[3], "d");
+}
+
+TEST_F(ScriptCheckerTest, Check_ReportsEveryErrorWithLine) {
+    const std::string script =
+        "create A B C\n"
+        "bogus\n"
+        "\n"
+        "addshape x circle 1\n"
+        "exit\n"
+        "create only\n";
+    ScriptChecker checker(registry_);
+    
+    CheckResult result = checker.check(script, &pool_);
+    
+    EXPECT_EQ(result.lines, 6);
+    EXPECT_EQ(result.commands, 5);
+    ASSERT_EQ(result.errors.size(), 3);  // Lines after exit are checked too
+    EXPECT_EQ(result.errors[0].line, 2);
+    EXPECT_EQ(result.errors[1].line, 4);
+    EXPECT_EQ(result.errors[2].line, 6);
+}
+
+TEST_F(ScriptCheckerTest, Check_SmallChunks_MatchOneChunk) {
+    std::string script;
+    for (int i = 0; i < 2000; ++i) {
+        script += (i % 37 == 0) ? "addshape 1 hexagon\r\n" : "create T C D\r\n";
+        if (i % 11 == 0) {
+            script += "\n";
+        }
+    }
+    ScriptChecker checker(registry_);
+    
+    CheckResult whole = checker.check(script, &pool_, script.size());
+    CheckResult chunked = checker.check(script, &pool_, 100);
+    
+    EXPECT_EQ(chunked.lines, whole.lines);
+    EXPECT_EQ(chunked.commands, 2000);
+    ASSERT_EQ(chunked.errors.size(), whole.errors.size());
+    for (size_t i = 0; i < whole.errors.size(); ++i) {
+        EXPECT_EQ(chunked.errors[i].line, whole.errors[i].line);
+        EXPECT_EQ(chunked.errors[i].message, whole.errors[i].message);
+    }
+    EXPECT_EQ(whole.errors.size(), 55);
+}
+
+TEST_F(ScriptCheckerTest, Check_LoneCarriageReturnsCountAsLines) {
+    ScriptChecker checker(registry_);
+    
+    CheckResult result = checker.check("create A B C\rbogus\rcreate D E F", &pool_);
+    
+    EXPECT_EQ(result.lines, 3);
+    ASSERT_EQ(result.errors.size(), 1);
+    EXPECT_EQ(result.errors[0].line, 2);
+}
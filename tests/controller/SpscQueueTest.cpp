@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "controller/SpscQueue.hpp"
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace slideEditor::controller;
+
+TEST(SpscQueueTest, Capacity_RoundsUpToPowerOfTwo) {
+    SpscQueue<int> queue(5);
+    
+    EXPECT_EQ(queue.capacity(), 8);
+}
+
+TEST(SpscQueueTest, PushPop_FifoOrder) {
+    SpscQueue<int> queue(4);
+    
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    
+    int value = 0;
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.tryPop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(SpscQueueTest, TryPush_FullQueue_LeavesItem) {
+    SpscQueue<std::unique_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(2)));
+    
+    auto item = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.tryPush(std::move(item)));
+    ASSERT_NE(item, nullptr);
+    
+    std::unique_ptr<int> popped;
+    EXPECT_TRUE(queue.tryPop(popped));
+    EXPECT_TRUE(queue.tryPush(std::move(item)));
+    EXPECT_EQ(item, nullptr);
+}
+
+TEST(SpscQueueTest, WrapsAround) {
+    SpscQueue<std::string> queue(4);
+    std::string value;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(queue.tryPush(std::to_string(i)));
+        EXPECT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, std::to_string(i));
+    }
+}
+
+TEST(SpscQueueTest, TwoThreads_DeliverEveryItemInOrder) {
+    constexpr int COUNT = 200000;
+    SpscQueue<int> queue(64);
+    
+    std::thread producer([&] {
+        for (int i = 0; i < COUNT; ++i) {
+            while (!queue.tryPush(int(i))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    
+    int expected = 0;
+    int value = 0;
+    bool ordered = true;
+    while (expected < COUNT) {
+        if (queue.tryPop(value)) {
+            ordered = ordered && value == expected;
+            ++expected;
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    
+    EXPECT_TRUE(ordered);
+}
@@ -240,4 +240,21 @@ TEST_F(CommandParserTest, ArgumentTypes_PreserveTypes) {
     // Third is double
     EXPECT_EQ(result.arguments[2].type, "double");
     EXPECT_DOUBLE_EQ(result.arguments[2].asDouble(), 3.14);
-}
\ No newline at end of file
+}
+
+TEST_F(CommandParserTest, ResetOverText_ParsesEachSpan) {
+    CommandParser parser;
+    parser.setRegistry(registry_.get());
+    
+    parser.reset("ADDSHAPE 3 circle 1.5");
+    ParsedCommand first = parser.parseCommand();
+    parser.reset("create A B C");
+    ParsedCommand second = parser.parseCommand();
+    
+    ASSERT_TRUE(first.isValid) << "Error: " << first.errorMessage;
+    EXPECT_EQ(first.commandName, "addshape");
+    EXPECT_EQ(first.arguments[0].asInt(), 3);
+    EXPECT_DOUBLE_EQ(first.arguments[2].asDouble(), 1.5);
+    ASSERT_TRUE(second.isValid) << "Error: " << second.errorMessage;
+    EXPECT_EQ(second.arguments[2].asString(), "C");
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "controller/parser/KeywordTable.hpp"
+#include <set>
+#include <string>
+
+using namespace slideEditor::controller;
+
+class KeywordTableTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+};
+
+TEST_F(KeywordTableTest, Find_ReturnsIndexOfEveryKeyword) {
+    for (size_t i = 0; i < keywords::kCount; ++i) {
+        EXPECT_EQ(keywords::find(keywords::kNames[i]), static_cast<int>(i));
+    }
+}
+
+TEST_F(KeywordTableTest, Find_IsCaseInsensitive) {
+    EXPECT_EQ(keywords::find("CREATE"), keywords::find("create"));
+    EXPECT_EQ(keywords::find("RemoveShape"), keywords::find("removeshape"));
+    EXPECT_TRUE(keywords::isKeyword("DrawPages"));
+}
+
+TEST_F(KeywordTableTest, Find_RejectsNonKeywords) {
+    EXPECT_EQ(keywords::find(""), keywords::kNotFound);
+    EXPECT_EQ(keywords::find("circle"), keywords::kNotFound);
+    EXPECT_EQ(keywords::find("creat"), keywords::kNotFound);
+    EXPECT_EQ(keywords::find("creates"), keywords::kNotFound);
+    EXPECT_EQ(keywords::find("removeshapes"), keywords::kNotFound);
+    EXPECT_FALSE(keywords::isKeyword("draw_"));
+}
+
+TEST_F(KeywordTableTest, Hash_MapsKeywordsToDistinctSlots) {
+    std::set<uint32_t> slots;
+    for (const auto& name : keywords::kNames) {
+        slots.insert(keywords::hash(name, keywords::detail::kSeed) & keywords::detail::kTableMask);
+    }
+
+    EXPECT_EQ(slots.size(), keywords::kCount);
+}
+
+TEST_F(KeywordTableTest, Find_WorksAtCompileTime) {
+    static_assert(keywords::isKeyword("EXIT"));
+    static_assert(!keywords::isKeyword("quit"));
+    SUCCEED();
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "controller/parser/SpanLexer.hpp"
+#include "controller/parser/Lexer.hpp"
+#include "io/InputStream.hpp"
+#include <memory>
+
+using namespace slideEditor::controller;
+using namespace slideEditor::io;
+
+class SpanLexerTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    
+    std::vector<SpanToken> tokenize(SpanLexer& lexer) {
+        std::vector<SpanToken> tokens;
+        SpanToken token = lexer.nextToken();
+        while (token.type != TokenType::END_OF_FILE && token.type != TokenType::ERROR) {
+            if (token.type != TokenType::END_OF_LINE) {
+                tokens.push_back(token);
+            }
+            token = lexer.nextToken();
+        }
+        
+        if (token.type == TokenType::ERROR) {
+            tokens.push_back(token);
+        }
+        
+        return tokens;
+    }
+};
+
+TEST_F(SpanLexerTest, TokenizeCommand_ReturnsSliceOfText) {
+    const std::string text = "  CREATE";
+    SpanLexer lexer(text);
+    auto tokens = tokenize(lexer);
+    
+    ASSERT_EQ(tokens.size(), 1);
+    EXPECT_EQ(tokens[0].type, TokenType::COMMAND);
+    EXPECT_EQ(tokens[0].offset, 2);
+    EXPECT_EQ(tokens[0].length, 6);
+    EXPECT_EQ(lexer.textOf(tokens[0]), "CREATE");
+    EXPECT_EQ(lexer.textOf(tokens[0]).data(), text.data() + 2);  // No copy
+    EXPECT_EQ(lexer.toToken(tokens[0]).asString(), "create");
+}
+
+TEST_F(SpanLexerTest, TokenizeIdentifier_ReturnsIdentifierToken) {
+    SpanLexer lexer("myidentifier");
+    auto tokens = tokenize(lexer);
+    
+    ASSERT_EQ(tokens.size(), 1);
+    EXPECT_EQ(tokens[0].type, TokenType::IDENTIFIER);
+    EXPECT_EQ(tokens[0].keyword, -1);
+    EXPECT_EQ(lexer.textOf(tokens[0]), "myidentifier");
+}
+
+TEST_F(SpanLexerTest, TokenizeNumbers_ConvertsValues) {
+    SpanLexer lexer("42 3.25 7.");
+    auto tokens = tokenize(lexer);
+    
+    ASSERT_EQ(tokens.size(), 3);
+    EXPECT_TRUE(tokens[0].isInteger);
+    EXPECT_EQ(tokens[0].intValue, 42);
+    EXPECT_FALSE(tokens[1].isInteger);
+    EXPECT_DOUBLE_EQ(tokens[1].doubleValue, 3.25);
+    EXPECT_DOUBLE_EQ(tokens[2].doubleValue, 7.0);
+}
+
+TEST_F(SpanLexerTest, TokenizeOverflowingInteger_ReturnsError) {
+    SpanLexer lexer("99999999999");
+    auto tokens = tokenize(lexer);
+    
+    ASSERT_EQ(tokens.size(), 1);
+    EXPECT_EQ(tokens[0].type, TokenType::ERROR);
+}
+
+TEST_F(SpanLexerTest, TokenizeInvalidCharacter_ReturnsError) {
+    SpanLexer lexer("save file.json");
+    auto tokens = tokenize(lexer);
+    
+    ASSERT_EQ(tokens.size(), 2);
+    EXPECT_EQ(tokens[1].type, TokenType::ERROR);
+    EXPECT_EQ(tokens[1].offset, 9);
+}
+
+TEST_F(SpanLexerTest, TokenizeMultipleLines_TracksLinesAndColumns) {
+    SpanLexer lexer("create a b c\n  addshape 1 circle 2.0\n");
+    auto tokens = tokenize(lexer);
+    
+    ASSERT_EQ(tokens.size(), 8);
+    EXPECT_EQ(tokens[4].type, TokenType::COMMAND);
+    EXPECT_EQ(tokens[4].line, 2);
+    EXPECT_EQ(tokens[4].column, 3);
+    EXPECT_EQ(lexer.getLine(), 3);
+}
+
+TEST_F(SpanLexerTest, Reset_StartsOverOnNewText) {
+    SpanLexer lexer("undo");
+    lexer.nextToken();
+    lexer.reset("redo 5");
+    auto tokens = tokenize(lexer);
+    
+    ASSERT_EQ(tokens.size(), 2);
+    EXPECT_EQ(lexer.textOf(tokens[0]), "redo");
+    EXPECT_EQ(tokens[0].line, 1);
+}
+
+TEST_F(SpanLexerTest, MatchesStreamLexer) {
+    const std::string text = "create Title Body dark\naddshape 1 circle 2.5 red blue\n\tremoveshape 1 0\nexit";
+    auto stream = std::make_unique<InputStream>(text);
+    Lexer streamLexer(stream.get());
+    SpanLexer spanLexer(text);
+    
+    while (true) {
+        Token expected = streamLexer.nextToken();
+        Token actual = spanLexer.toToken(spanLexer.nextToken());
+        ASSERT_EQ(actual.type, expected.type);
+        EXPECT_EQ(actual.line, expected.line);
+        EXPECT_EQ(actual.column, expected.column);
+        if (expected.type == TokenType::IDENTIFIER) {
+            EXPECT_EQ(actual.asString(), expected.asString());
+        }
+        if (expected.type == TokenType::NUMBER) {
+            EXPECT_DOUBLE_EQ(actual.asDouble(), expected.asDouble());
+        }
+        if (expected.type == TokenType::END_OF_FILE) {
+            break;
+        }
+    }
+}
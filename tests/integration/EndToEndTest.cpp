@@ -4,8 +4,12 @@
 #include "serialization/JsonSerializer.hpp"
 #include "view/cli/CliView.hpp"
 #include "io/InputStream.hpp"
+#include "io/OutputStream.hpp"
 #include <sstream>
 #include <memory>
+#include <chrono>
+#include <ctime>
+#include <thread>
 
 using namespace slideEditor;
 
@@ -88,4 +92,334 @@ TEST_F(EndToEndTest, InvalidCommand_ShowsError) {
     
     std::string output = getOutput();
     EXPECT_NE(output.find("ERROR"), std::string::npos);
-}
\ No newline at end of file
+}
+
+TEST_F(EndToEndTest, RunBatch_ProcessesScriptWithoutPrompts) {
+    auto input = std::make_shared<io::InputStream>(
+        std::string("create A B C\n\ncreate D E F\naddshape 1 circle 1.0\nexit\ncreate G H I\n"));
+    controller::CommandController controller(repository_, serializer_, view_, input);
+    
+    controller::BatchStats stats = controller.runBatch();
+    
+    EXPECT_EQ(stats.commands, 4);  // Stops at exit
+    EXPECT_EQ(stats.failures, 0);
+    EXPECT_EQ(repository_->getSlideCount(), 2);
+    EXPECT_EQ(getOutput().find("> "), std::string::npos);
+    EXPECT_EQ(getOutput().find("Interactive Mode"), std::string::npos);
+}
+
+TEST_F(EndToEndTest, RunBatch_StopOnError_EndsAtFirstFailure) {
+    const std::string script = "create A B C\nbogus\ncreate D E F\n";
+    auto input = std::make_shared<io::InputStream>(script);
+    controller::CommandController controller(repository_, serializer_, view_, input);
+    
+    controller::BatchStats stats = controller.runBatch(true);
+    
+    EXPECT_TRUE(stats.stopped);
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_EQ(stats.firstFailedLine, 2);
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+    
+    // Without stopOnError the run continues past the failure
+    auto rerun = std::make_shared<io::InputStream>(script);
+    controller::CommandController tolerant(repository_, serializer_, view_, rerun);
+    stats = tolerant.runBatch();
+    EXPECT_FALSE(stats.stopped);
+    EXPECT_EQ(stats.firstFailedLine, 2);
+    EXPECT_EQ(repository_->getSlideCount(), 3);
+}
+
+TEST_F(EndToEndTest, RunBatch_SharedBufferedOutput_KeepsOrderAndFlushesAtEnd) {
+    std::ostringstream out;
+    auto output = std::make_shared<io::OutputStream>(out, io::OutputStream::Buffering::FULL);
+    auto view = std::make_shared<view::CliView>(output);
+    auto input = std::make_shared<io::InputStream>(std::string("create A B C\nbogus\ncreate D E F\n"));
+    controller::CommandController controller(repository_, serializer_, view, input);
+    controller.setOutput(output);
+    
+    controller.runBatch();
+    
+    const std::string text = out.str();
+    const size_t first = text.find("ID: 1");
+    const size_t error = text.find("[ERROR]");
+    const size_t second = text.find("ID: 2");
+    ASSERT_NE(second, std::string::npos);  // Written out when the run ended
+    EXPECT_LT(first, error);
+    EXPECT_LT(error, second);
+}
+
+TEST_F(EndToEndTest, BufferedOutput_CommandErrorIsWrittenBeforeNextCommand) {
+    std::ostringstream out;
+    auto output = std::make_shared<io::OutputStream>(out, io::OutputStream::Buffering::FULL);
+    auto view = std::make_shared<view::CliView>(output);
+    controller::CommandController controller(repository_, serializer_, view, nullptr);
+    controller.setOutput(output);
+    
+    controller.processCommand("create A B C");
+    EXPECT_EQ(out.str(), "");  // Successes wait for a flush point
+    
+    controller.processCommand("removeshape 9 0");
+    EXPECT_NE(out.str().find("ID: 1"), std::string::npos);
+    EXPECT_NE(out.str().find("[ERROR] Error: Slide with ID 9 not found"), std::string::npos);
+}
+
+TEST_F(EndToEndTest, RunBatch_ManyBlankLines_DoesNotRecurse) {
+    // Blank lines used to cost one stack frame each
+    std::string script = "create A B C\n";
+    script.append(2'000'000, '\n');
+    script += "bogus\n";
+    std::istringstream source(script);
+    auto input = std::make_shared<io::InputStream>(source, io::InputStream::FillMode::BLOCK);
+    controller::CommandController controller(repository_, serializer_, view_, input);
+    
+    controller::BatchStats stats = controller.runBatch();
+    
+    EXPECT_EQ(stats.commands, 2);
+    EXPECT_EQ(stats.firstFailedLine, 2'000'002);
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+}
+
+TEST_F(EndToEndTest, CompilePlan_ReportsEveryBadLine) {
+    std::vector<controller::PlanError> errors;
+    controller::CommandPlan plan = controller_->compilePlan(
+        "create A B C\nbogus\n\naddshape x circle 1\ncreate D E F\n", errors);
+    
+    ASSERT_EQ(errors.size(), 2);
+    EXPECT_EQ(errors[0].line, 2);
+    EXPECT_EQ(errors[1].line, 4);
+    EXPECT_EQ(plan.size(), 2);
+    EXPECT_EQ(plan.getOperations()[1].line, 5);
+}
+
+TEST_F(EndToEndTest, RunPlan_MatchesRunBatch) {
+    const std::string script =
+        "create A B C\ncreate D E F\naddshape 1 circle 1.5\nremoveshape 9 0\nexit\ncreate G H I\n";
+    std::vector<controller::PlanError> errors;
+    controller::CommandPlan plan = controller_->compilePlan(script, errors);
+    ASSERT_TRUE(errors.empty());
+    EXPECT_EQ(plan.size(), 5);  // Nothing after exit
+    
+    // Run a saved and reloaded copy
+    std::stringstream file;
+    ASSERT_TRUE(plan.save(file));
+    controller::CommandPlan loaded;
+    ASSERT_TRUE(loaded.load(file));
+    
+    controller::BatchStats stats = controller_->runPlan(loaded);
+    
+    EXPECT_EQ(stats.commands, 5);
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_EQ(stats.firstFailedLine, 4);
+    EXPECT_EQ(repository_->getSlideCount(), 2);
+    EXPECT_EQ(repository_->getSlide(1)->getShapes().size(), 1);
+    
+    // Compiled actions are undoable like parsed ones
+    EXPECT_TRUE(executeCommand("undo"));
+    EXPECT_EQ(repository_->getSlide(1)->getShapes().size(), 0);
+}
+
+TEST_F(EndToEndTest, RunPlan_StopOnError_EndsAtFirstFailure) {
+    std::vector<controller::PlanError> errors;
+    controller::CommandPlan plan = controller_->compilePlan(
+        "create A B C\nremoveshape 5 0\ncreate D E F\n", errors);
+    
+    controller::BatchStats stats = controller_->runPlan(plan, true);
+    
+    EXPECT_TRUE(stats.stopped);
+    EXPECT_EQ(stats.firstFailedLine, 2);
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+}
+
+TEST_F(EndToEndTest, LoadPlan_RejectsMalformedInput) {
+    std::vector<controller::PlanError> errors;
+    controller::CommandPlan plan = controller_->compilePlan("create A B C\n", errors);
+    std::stringstream file;
+    plan.save(file);
+    std::string bytes = file.str();
+    
+    controller::CommandPlan loaded;
+    std::istringstream truncated(bytes.substr(0, bytes.size() - 3));
+    EXPECT_FALSE(loaded.load(truncated));
+    EXPECT_TRUE(loaded.empty());
+    
+    std::istringstream garbage("not a plan");
+    EXPECT_FALSE(loaded.load(garbage));
+    
+    // Opcode past the keyword table
+    bytes[6 + 2 + 4 + 4] = static_cast<char>(200);
+    std::istringstream badOpcode(bytes);
+    EXPECT_FALSE(loaded.load(badOpcode));
+}
+
+TEST_F(EndToEndTest, LoadPlan_RejectsForgedCounts) {
+    std::vector<controller::PlanError> errors;
+    controller::CommandPlan plan = controller_->compilePlan("create A B C\n", errors);
+    std::stringstream file;
+    plan.save(file);
+    const std::string bytes = file.str();
+    const uint32_t huge = 0xFFFFFFF0u;
+    
+    // Header counts and string lengths far past the data must fail, not allocate
+    for (size_t offset : {size_t{6 + 2}, size_t{6 + 2 + 4}, size_t{6 + 2 + 4 + 4 + 10 + 1}}) {
+        std::string forged = bytes;
+        forged.replace(offset, sizeof(huge), reinterpret_cast<const char*>(&huge), sizeof(huge));
+        std::istringstream in(forged);
+        controller::CommandPlan loaded;
+        EXPECT_FALSE(loaded.load(in)) << "offset " << offset;
+        EXPECT_TRUE(loaded.empty());
+    }
+}
+
+TEST_F(EndToEndTest, RunPlan_RejectsArgumentsThatDoNotFitTheCommand) {
+    std::vector<controller::PlanError> errors;
+    controller::CommandPlan plan = controller_->compilePlan(
+        "create A B C\ncreate D E F\n", errors);
+    std::stringstream file;
+    plan.save(file);
+    std::string bytes = file.str();
+    
+    // First op keeps its slots in range but claims only two of create's three
+    bytes[6 + 2 + 4 + 4 + 1] = 2;
+    std::istringstream in(bytes);
+    controller::CommandPlan loaded;
+    ASSERT_TRUE(loaded.load(in));
+    
+    controller::BatchStats stats = controller_->runPlan(loaded);
+    
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_EQ(stats.firstFailedLine, 1);
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+    EXPECT_NE(getOutput().find("Invalid arguments for command: create"), std::string::npos);
+}
+
+TEST_F(EndToEndTest, RunPipelined_MatchesRunBatch) {
+    std::string script;
+    for (int i = 0; i < 3000; ++i) {
+        script += "create T" + std::to_string(i) + " C D\n";
+        script += (i % 100 == 0) ? "bogus\n" : "\n";
+    }
+    script += "exit\ncreate After X Y\n";
+    
+    auto batchInput = std::make_shared<io::InputStream>(script);
+    controller::CommandController batch(repository_, serializer_, view_, batchInput);
+    controller::BatchStats expected = batch.runBatch();
+    const std::string expectedOutput = getOutput();
+    
+    viewOutput_.str("");
+    auto pipelinedRepository = std::make_shared<model::SlideRepository>();
+    auto pipelinedInput = std::make_shared<io::InputStream>(script);
+    controller::CommandController pipelined(pipelinedRepository, serializer_, view_, pipelinedInput);
+    controller::BatchStats stats = pipelined.runPipelined();
+    
+    EXPECT_EQ(stats.commands, expected.commands);
+    EXPECT_EQ(stats.failures, expected.failures);
+    EXPECT_EQ(stats.firstFailedLine, expected.firstFailedLine);
+    EXPECT_EQ(pipelinedRepository->getSlideCount(), 3000);
+    EXPECT_EQ(getOutput(), expectedOutput);
+}
+
+TEST_F(EndToEndTest, RunPipelined_StopOnError_EndsAtFirstFailure) {
+    std::string script = "create A B C\nbogus\n";
+    for (int i = 0; i < 5000; ++i) {
+        script += "create D E F\n";
+    }
+    auto input = std::make_shared<io::InputStream>(script);
+    controller::CommandController controller(repository_, serializer_, view_, input);
+    
+    controller::BatchStats stats = controller.runPipelined(true);
+    
+    EXPECT_TRUE(stats.stopped);
+    EXPECT_EQ(stats.commands, 2);
+    EXPECT_EQ(stats.firstFailedLine, 2);
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+}
+
+// Input that stalls like a slow pipe before its only line
+class SlowStreamBuf : public std::streambuf {
+protected:
+    int_type underflow() override {
+        if (delivered_) {
+            return traits_type::eof();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        delivered_ = true;
+        setg(line_, line_, line_ + sizeof(line_) - 1);
+        return traits_type::to_int_type(line_[0]);
+    }
+
+private:
+    char line_[14] = "create A B C\n";
+    bool delivered_ = false;
+};
+
+TEST_F(EndToEndTest, RunPipelined_WaitingExecutorSleeps) {
+    SlowStreamBuf buffer;
+    std::istream source(&buffer);
+    auto input = std::make_shared<io::InputStream>(source, io::InputStream::FillMode::BLOCK);
+    controller::CommandController controller(repository_, serializer_, view_, input);
+    
+    const std::clock_t cpuStart = std::clock();
+    controller::BatchStats stats = controller.runPipelined();
+    const double cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    
+    EXPECT_EQ(stats.commands, 1);
+    EXPECT_EQ(repository_->getSlideCount(), 1);
+    EXPECT_LT(cpuSeconds, 0.15);  // Spinning through the stall would cost about 0.3 s
+}
+
+TEST_F(EndToEndTest, Transaction_CommitsSilentlyAsOneUndoStep) {
+    executeCommand("create A B C");
+    executeCommand("begin");
+    testing::internal::CaptureStdout();
+    for (int i = 0; i < 100; ++i) {
+        executeCommand("addshape 1 circle 1.0");
+    }
+    executeCommand("commit");
+    const std::string output = testing::internal::GetCapturedStdout();
+    
+    EXPECT_EQ(output.find("added to slide"), std::string::npos);
+    EXPECT_NE(output.find("Committed 100 actions"), std::string::npos);
+    EXPECT_EQ(repository_->getSlide(1)->getShapeCount(), 100);
+    
+    executeCommand("undo");
+    EXPECT_EQ(repository_->getSlide(1)->getShapeCount(), 0);
+    EXPECT_EQ(repository_->getSlideCount(), 1);  // The create before begin stays
+}
+
+TEST_F(EndToEndTest, Transaction_RollbackAndErrors) {
+    executeCommand("create A B C");
+    executeCommand("begin");
+    executeCommand("addshape 1 circle 1.0");
+    executeCommand("addshape 7 circle 1.0");
+    EXPECT_NE(getOutput().find("Slide with ID 7 not found"), std::string::npos);
+    
+    EXPECT_TRUE(executeCommand("rollback"));
+    EXPECT_EQ(repository_->getSlide(1)->getShapeCount(), 0);
+    
+    testing::internal::CaptureStdout();
+    executeCommand("commit");
+    EXPECT_NE(testing::internal::GetCapturedStdout().find("No open transaction"), std::string::npos);
+}
+
+TEST_F(EndToEndTest, Transaction_LeftOpenAtEndOfRun_RollsBackAndFails) {
+    auto input = std::make_shared<io::InputStream>("create a b c\nbegin\naddshape 1 circle 1.5\n");
+    controller::CommandController batch(repository_, serializer_, view_, input);
+    controller::BatchStats stats = batch.runBatch();
+    
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_EQ(repository_->getSlide(1)->getShapeCount(), 0);
+    EXPECT_NE(getOutput().find("Transaction left open; rolled back 1 actions"), std::string::npos);
+    
+    // Same when exit ends the run
+    std::vector<controller::PlanError> errors;
+    controller::CommandPlan plan = controller_->compilePlan(
+        "begin\naddshape 1 circle 1.5\nexit\n", errors);
+    stats = controller_->runPlan(plan);
+    
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_EQ(repository_->getSlide(1)->getShapeCount(), 0);
+    
+    testing::internal::CaptureStdout();
+    executeCommand("commit");
+    EXPECT_NE(testing::internal::GetCapturedStdout().find("No open transaction"), std::string::npos);
+}
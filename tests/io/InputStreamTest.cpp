@@ -149,4 +149,86 @@ TEST_F(InputStreamTest, ReadEntireString) {
     
     EXPECT_EQ(result, "hello");
     EXPECT_TRUE(stream.eof());
-}
\ No newline at end of file
+}
+
+TEST_F(InputStreamTest, ReadLine_HandlesAllLineBreaks) {
+    InputStream stream("one\ntwo\r\nthree\rfour");
+    std::string line;
+    
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "one");
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "two");
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "three");
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "four");
+    EXPECT_FALSE(stream.readLine(line));
+    EXPECT_TRUE(stream.eof());
+}
+
+TEST_F(InputStreamTest, ReadLine_ReturnsEmptyLines) {
+    InputStream stream("\n\nx\n");
+    std::string line = "stale";
+    
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_TRUE(line.empty());
+    ASSERT_TRUE(stream.readLine(line));
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "x");
+    EXPECT_FALSE(stream.readLine(line));
+}
+
+TEST_F(InputStreamTest, ReadLine_SpansBufferRefills) {
+    const std::string longLine(InputStream::BLOCK_SIZE * 2 + 17, 'a');
+    std::istringstream iss(longLine + "\r\n" + "tail");
+    InputStream stream(iss, InputStream::FillMode::BLOCK);
+    std::string line;
+    
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, longLine);
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "tail");
+    EXPECT_FALSE(stream.readLine(line));
+}
+
+TEST_F(InputStreamTest, ReadLine_CarriageReturnAtBlockEnd) {
+    // The '\r' is the last byte of the first block and its '\n' starts the next
+    const std::string first(InputStream::BLOCK_SIZE - 1, 'b');
+    std::istringstream iss(first + "\r\nnext\n");
+    InputStream stream(iss, InputStream::FillMode::BLOCK);
+    std::string line;
+    
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line.size(), first.size());
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "next");
+}
+
+TEST_F(InputStreamTest, Read_CopiesAcrossRefills) {
+    std::string text(InputStream::BLOCK_SIZE + 100, 'x');
+    text.back() = 'y';
+    std::istringstream iss(text);
+    InputStream stream(iss);
+    std::string copy(text.size() + 10, '\0');
+    
+    const size_t count = stream.read(copy.data(), copy.size());
+    
+    EXPECT_EQ(count, text.size());
+    EXPECT_EQ(copy.substr(0, count), text);
+    EXPECT_EQ(stream.read(copy.data(), copy.size()), 0);
+}
+
+TEST_F(InputStreamTest, Get_MixesWithReadLine) {
+    std::istringstream iss("ab\ncd");
+    InputStream stream(iss);
+    std::string line;
+    
+    EXPECT_EQ(stream.get().value(), 'a');
+    ASSERT_TRUE(stream.readLine(line));
+    EXPECT_EQ(line, "b");
+    EXPECT_EQ(stream.peek().value(), 'c');
+    stream.get();
+    stream.unget();
+    EXPECT_EQ(stream.get().value(), 'c');
+}
@@ -97,4 +97,40 @@ TEST_F(OutputStreamTest, GetOutput_ReturnsEmptyForExternalStream) {
     
     // But the external buffer should have the data
     EXPECT_EQ(buffer.str(), "test");
-}
\ No newline at end of file
+}
+
+TEST_F(OutputStreamTest, Buffered_HoldsWritesUntilFlush) {
+    std::ostringstream buffer;
+    OutputStream stream(buffer, OutputStream::Buffering::FULL);
+    
+    stream.write("hello ");
+    stream.writeLine("world");
+    EXPECT_EQ(buffer.str(), "");
+    
+    stream.flush();
+    EXPECT_EQ(buffer.str(), "hello world\n");
+}
+
+TEST_F(OutputStreamTest, Buffered_WritesOutWhenFull) {
+    std::ostringstream buffer;
+    OutputStream stream(buffer, OutputStream::Buffering::FULL);
+    const std::string line(1000, 'x');
+    
+    size_t written = 0;
+    while (written < OutputStream::BUFFER_CAPACITY) {
+        stream.writeLine(line);
+        written += line.size() + 1;
+    }
+    
+    EXPECT_EQ(buffer.str().size(), written);
+}
+
+TEST_F(OutputStreamTest, Buffered_FlushesOnDestruction) {
+    std::ostringstream buffer;
+    {
+        OutputStream stream(buffer, OutputStream::Buffering::FULL);
+        stream.writeLine("pending");
+    }
+    
+    EXPECT_EQ(buffer.str(), "pending\n");
+}
@@ -88,6 +88,21 @@ TEST_F(ShapeTest, RectangleDimensions_ScaleCorrectly) {
     EXPECT_DOUBLE_EQ(rect.getRectangleHeight(), 90.0);   // 60 * 1.5
 }
 
+TEST_F(ShapeTest, GetBounds_EnclosesGeometry) {
+    Shape rect(ShapeType::RECTANGLE, 1.0);
+    BoundingBox box = rect.getBounds(200, 100);
+    EXPECT_DOUBLE_EQ(box.x, 150.0);
+    EXPECT_DOUBLE_EQ(box.y, 70.0);
+    EXPECT_DOUBLE_EQ(box.width, 100.0);
+    EXPECT_DOUBLE_EQ(box.height, 60.0);
+    
+    // The triangle is placed by its centroid, so two thirds of it lie above y
+    Shape triangle(ShapeType::TRIANGLE, 1.0);
+    box = triangle.getBounds(0, 0);
+    EXPECT_DOUBLE_EQ(box.width, 80.0);
+    EXPECT_DOUBLE_EQ(box.y, -box.height * 2.0 / 3.0);
+}
+
 TEST_F(ShapeTest, ToSVG_GeneratesValidSVG) {
     Shape circle(ShapeType::CIRCLE, 1.0, Color::Red(), Color::Blue());
     std::string svg = circle.toSVG(100, 100);
@@ -34,6 +34,27 @@ TEST_F(SlideRepositoryTest, AddSlide_AutoIncrementsId) {
     EXPECT_EQ(id2, id1 + 1);
 }
 
+TEST_F(SlideRepositoryTest, AddSlide_AssignsIdToSlide) {
+    int id1 = repository.addSlide(std::make_unique<Slide>(0, "Title1", "Content1", "Theme1"));
+    int id2 = repository.addSlide(std::make_unique<Slide>(0, "Title2", "Content2", "Theme2"));
+    
+    EXPECT_EQ(repository.getSlide(id1)->getId(), id1);
+    EXPECT_EQ(repository.getSlide(id2)->getId(), id2);
+}
+
+TEST_F(SlideRepositoryTest, RemoveSlide_KeepsOtherSlidesReachable) {
+    int id1 = repository.addSlide(std::make_unique<Slide>(0, "Title1", "Content1", "Theme1"));
+    int id2 = repository.addSlide(std::make_unique<Slide>(0, "Title2", "Content2", "Theme2"));
+    int id3 = repository.addSlide(std::make_unique<Slide>(0, "Title3", "Content3", "Theme3"));
+    
+    ASSERT_TRUE(repository.removeSlide(id1));
+    
+    ASSERT_NE(repository.getSlide(id2), nullptr);
+    ASSERT_NE(repository.getSlide(id3), nullptr);
+    EXPECT_EQ(repository.getSlide(id2)->getTitle(), "Title2");
+    EXPECT_EQ(repository.getSlide(id3)->getTitle(), "Title3");
+}
+
 TEST_F(SlideRepositoryTest, AddSlide_ReturnsMinusOneForNull) {
     int id = repository.addSlide(nullptr);
     
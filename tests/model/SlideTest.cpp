@@ -82,4 +82,33 @@ TEST_F(SlideTest, Serialize_ReturnsJSON) {
     EXPECT_NE(json.find("\"id\":1"), std::string::npos);
     EXPECT_NE(json.find("\"title\":\"Title\""), std::string::npos);
     EXPECT_NE(json.find("\"shapes\":["), std::string::npos);
-}
\ No newline at end of file
+}
+
+TEST_F(SlideTest, Version_ChangesOnAddAndRemove) {
+    Slide slide(1, "Title", "Content", "Theme");
+    auto initial = slide.getVersion();
+    
+    slide.addShape(std::make_unique<Shape>(ShapeType::CIRCLE));
+    auto afterAdd = slide.getVersion();
+    slide.removeShape(0);
+    
+    EXPECT_NE(afterAdd, initial);
+    EXPECT_NE(slide.getVersion(), afterAdd);
+}
+
+TEST_F(SlideTest, Version_UnchangedOnFailedRemove) {
+    Slide slide(1, "Title", "Content", "Theme");
+    auto initial = slide.getVersion();
+    
+    slide.removeShape(5);
+    slide.addShape(nullptr);
+    
+    EXPECT_EQ(slide.getVersion(), initial);
+}
+
+TEST_F(SlideTest, Version_UniqueAcrossSlidesWithSameId) {
+    Slide first(1, "Title", "Content", "Theme");
+    Slide second(1, "Title", "Content", "Theme");
+    
+    EXPECT_NE(first.getVersion(), second.getVersion());
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "model/SvgFormatter.hpp"
+#include "model/shapes/Shape.hpp"
+
+using namespace slideEditor::model;
+using namespace slideEditor::core;
+
+class SvgFormatterTest : public ::testing::Test {
+protected:
+    std::string out_;
+    
+    std::string number(double value) {
+        out_.clear();
+        SvgFormatter::appendNumber(out_, value);
+        return out_;
+    }
+};
+
+TEST_F(SvgFormatterTest, AppendNumber_IntegersHaveNoFraction) {
+    EXPECT_EQ(number(100.0), "100");
+    EXPECT_EQ(number(0.0), "0");
+    EXPECT_EQ(number(-40.0), "-40");
+}
+
+TEST_F(SvgFormatterTest, AppendNumber_UsesFixedPrecision) {
+    EXPECT_EQ(number(12.5), "12.5");
+    EXPECT_EQ(number(43.30127), "43.3");
+    EXPECT_EQ(number(1.005001), "1.01");
+    EXPECT_EQ(number(0.333333), "0.33");
+}
+
+TEST_F(SvgFormatterTest, AppendNumber_NoNegativeZero) {
+    EXPECT_EQ(number(-0.001), "0");
+    EXPECT_EQ(number(-0.0), "0");
+}
+
+TEST_F(SvgFormatterTest, AppendNumber_AppendsToExistingContent) {
+    out_ = "x=";
+    SvgFormatter::appendNumber(out_, 7.25);
+    
+    EXPECT_EQ(out_, "x=7.25");
+}
+
+TEST_F(SvgFormatterTest, AppendHexColor_MatchesToHex) {
+    Color orange = Color::Orange();
+    SvgFormatter::appendHexColor(out_, orange);
+    
+    EXPECT_EQ(out_, orange.toHex());
+}
+
+TEST_F(SvgFormatterTest, AppendCircle_WritesCompleteElement) {
+    SvgFormatter::appendCircle(out_, 100, 150, 50, SvgStyle{Color::Black(), Color::White(), 2.0});
+    
+    EXPECT_EQ(out_, "<circle cx=\"100\" cy=\"150\" r=\"50\" fill=\"#ffffff\" stroke=\"#000000\" "
+                    "stroke-width=\"2\" fill-opacity=\"1\" />");
+}
+
+TEST_F(SvgFormatterTest, AppendPolygon_WritesPointList) {
+    const double points[] = {1, 2, 3.5, 4, 5, 6.25};
+    SvgFormatter::appendPolygon(out_, points, 3, SvgStyle{Color::Red(), Color::Blue(), 2.0});
+    
+    EXPECT_EQ(out_.rfind("<polygon points=\"1,2 3.5,4 5,6.25\" ", 0), 0u);
+}
+
+TEST_F(SvgFormatterTest, ShapeAppendSVG_MatchesToSVG) {
+    Shape ellipse(ShapeType::ELLIPSE, 1.3, Color::Green(), Color::Yellow());
+    ellipse.appendSVG(out_, 220, 270);
+    
+    EXPECT_EQ(out_, ellipse.toSVG(220, 270));
+    EXPECT_NE(out_.find("rx=\"97.5\""), std::string::npos);
+}
+
+TEST_F(SvgFormatterTest, AppendStyle_ClassNameReplacesAttributes) {
+    SvgFormatter::appendCircle(out_, 10, 20, 5, SvgStyle{Color::Black(), Color::White(), 2.0, "s3"});
+    
+    EXPECT_EQ(out_, "<circle cx=\"10\" cy=\"20\" r=\"5\" class=\"s3\" />");
+}
+
+TEST_F(SvgFormatterTest, AppendStyleRule_WritesDeclarations) {
+    SvgFormatter::appendStyleRule(out_, SvgStyle{Color::Black(), Color::White(), 2.0});
+    
+    EXPECT_EQ(out_, "fill:#ffffff;stroke:#000000;stroke-width:2;fill-opacity:1");
+}
+
+TEST_F(SvgFormatterTest, AppendEscaped_CleanTextIsCopied) {
+    out_ = "x";
+    SvgFormatter::appendEscaped(out_, "Quarterly results 2024");
+    
+    EXPECT_EQ(out_, "xQuarterly results 2024");
+}
+
+TEST_F(SvgFormatterTest, AppendEscaped_ReplacesAllSpecialCharacters) {
+    SvgFormatter::appendEscaped(out_, "a<b>&\"c'");
+    
+    EXPECT_EQ(out_, "a&lt;b&gt;&amp;&quot;c&apos;");
+}
+
+TEST_F(SvgFormatterTest, AppendEscaped_FindsSpecialsAcrossVectorBlocks) {
+    // Specials at every offset of runs longer than one SIMD block must match the scalar result
+    for (size_t length = 1; length < 80; ++length) {
+        for (size_t pos = 0; pos < length; ++pos) {
+            std::string text(length, 'x');
+            text[pos] = '&';
+            text[length - 1 - (pos % length)] = pos % 2 ? '<' : '\'';
+            
+            std::string expected;
+            for (char c : text) {
+                if (c == '&') expected += "&amp;";
+                else if (c == '<') expected += "&lt;";
+                else if (c == '\'') expected += "&apos;";
+                else expected += c;
+            }
+            
+            out_.clear();
+            SvgFormatter::appendEscaped(out_, text);
+            ASSERT_EQ(out_, expected) << "length " << length << " pos " << pos;
+            ASSERT_EQ(SvgFormatter::findSpecial(text), std::min(pos, length - 1 - pos));
+        }
+    }
+}
+
+TEST_F(SvgFormatterTest, FindSpecial_IgnoresNeighbouringCharacters) {
+    // '=' '?' '%' '!' '#' sit next to the specials in ASCII
+    std::string text = "=?%!#$()*+,-./:;@[]^`{|}~ 0123456789abcdefghij";
+    
+    EXPECT_EQ(SvgFormatter::findSpecial(text), text.size());
+    EXPECT_EQ(SvgFormatter::findSpecial(text + ">", 3), text.size());
+}
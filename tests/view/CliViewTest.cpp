@@ -2,6 +2,7 @@
 #include "view/cli/CliView.hpp"
 #include "model/SlideRepository.hpp"
 #include "model/SlideFactory.hpp"
+#include "io/OutputStream.hpp"
 #include <sstream>
 #include <memory>
 
@@ -238,4 +239,44 @@ TEST_F(CliViewTest, AllMethodsWork_Integration) {
     EXPECT_NE(output.find(">"), std::string::npos);
     EXPECT_NE(output.find("Help works"), std::string::npos);
     EXPECT_NE(output.find("Test"), std::string::npos);
-}
\ No newline at end of file
+}
+
+// ========================================
+// Buffered Mode
+// ========================================
+
+TEST_F(CliViewTest, Buffered_MessagesWaitForPrompt) {
+    auto shared = std::make_shared<slideEditor::io::OutputStream>(
+        output_, slideEditor::io::OutputStream::Buffering::FULL);
+    CliView view(shared);
+    
+    view.displayMessage("Line 1");
+    shared->writeLine("Command output");
+    view.displayHelp("Help");
+    EXPECT_EQ(getOutput(), "");
+    
+    view.displayPrompt();
+    EXPECT_EQ(getOutput(), "Line 1\nCommand output\n\nHelp\n> ");
+}
+
+TEST_F(CliViewTest, Buffered_ErrorFlushesEarlierOutput) {
+    auto shared = std::make_shared<slideEditor::io::OutputStream>(
+        output_, slideEditor::io::OutputStream::Buffering::FULL);
+    CliView view(shared);
+    
+    shared->writeLine("Before");
+    view.displayError("Failed");
+    EXPECT_EQ(getOutput(), "Before\n[ERROR] Failed\n");
+}
+
+TEST_F(CliViewTest, Buffered_FlushWritesEverything) {
+    auto shared = std::make_shared<slideEditor::io::OutputStream>(
+        output_, slideEditor::io::OutputStream::Buffering::FULL);
+    CliView view(shared);
+    
+    view.displaySlides(&repository_);
+    EXPECT_EQ(getOutput(), "");
+    
+    view.flush();
+    EXPECT_NE(getOutput().find("No slides"), std::string::npos);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "view/raster/ImageWriter.hpp"
+#include <fstream>
+#include <iterator>
+#include <cstring>
+
+using namespace slideEditor::view;
+
+class ImageWriterTest : public ::testing::Test {
+protected:
+    std::string pngFile_ = "test_image.png";
+    std::string ppmFile_ = "test_image.ppm";
+    
+    void TearDown() override {
+        std::remove(pngFile_.c_str());
+        std::remove(ppmFile_.c_str());
+    }
+    
+    std::vector<unsigned char> readFile(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        return std::vector<unsigned char>(std::istreambuf_iterator<char>(file),
+                                          std::istreambuf_iterator<char>());
+    }
+    
+    static std::uint32_t readBigEndian32(const unsigned char* p) {
+        return (static_cast<std::uint32_t>(p[0]) << 24) | (static_cast<std::uint32_t>(p[1]) << 16) |
+               (static_cast<std::uint32_t>(p[2]) << 8) | p[3];
+    }
+    
+    RasterCanvas makeCanvas() {
+        RasterCanvas canvas(37, 21);
+        canvas.clear(RasterCanvas::packColor(10, 20, 30));
+        canvas.fillSpan(5, 3, 30, RasterCanvas::packColor(200, 100, 50));
+        return canvas;
+    }
+};
+
+TEST_F(ImageWriterTest, Crc32_MatchesKnownValue) {
+    const char* text = "123456789";
+    
+    EXPECT_EQ(ImageWriter::crc32(reinterpret_cast<const unsigned char*>(text), 9), 0xCBF43926u);
+}
+
+TEST_F(ImageWriterTest, ParseFormat_AcceptsKnownFormats) {
+    ImageFormat format = ImageFormat::PPM;
+    
+    EXPECT_TRUE(ImageWriter::parseFormat("PNG", format));
+    EXPECT_EQ(format, ImageFormat::PNG);
+    EXPECT_TRUE(ImageWriter::parseFormat("ppm", format));
+    EXPECT_EQ(format, ImageFormat::PPM);
+    EXPECT_FALSE(ImageWriter::parseFormat("gif", format));
+}
+
+TEST_F(ImageWriterTest, SavePPM_WritesHeaderAndPixels) {
+    ASSERT_TRUE(ImageWriter::save(makeCanvas(), ppmFile_, ImageFormat::PPM));
+    
+    auto data = readFile(ppmFile_);
+    std::string header = "P6\n37 21\n255\n";
+    ASSERT_EQ(data.size(), header.size() + 37 * 21 * 3);
+    EXPECT_EQ(std::string(data.begin(), data.begin() + header.size()), header);
+    EXPECT_EQ(data[header.size()], 10);
+    EXPECT_EQ(data[header.size() + 1], 20);
+    EXPECT_EQ(data[header.size() + 2], 30);
+}
+
+TEST_F(ImageWriterTest, SavePNG_HasValidChunkStructure) {
+    ASSERT_TRUE(ImageWriter::save(makeCanvas(), pngFile_, ImageFormat::PNG));
+    
+    auto data = readFile(pngFile_);
+    const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    ASSERT_GT(data.size(), 8u);
+    EXPECT_EQ(std::memcmp(data.data(), signature, 8), 0);
+    
+    std::vector<std::string> types;
+    size_t pos = 8;
+    while (pos + 12 <= data.size()) {
+        std::uint32_t length = readBigEndian32(&data[pos]);
+        ASSERT_LE(pos + 12 + length, data.size());
+        std::uint32_t crc = ImageWriter::crc32(&data[pos + 4], 4 + length);
+        EXPECT_EQ(crc, readBigEndian32(&data[pos + 8 + length]));
+        types.emplace_back(reinterpret_cast<const char*>(&data[pos + 4]), 4);
+        if (types.back() == "IHDR") {
+            EXPECT_EQ(readBigEndian32(&data[pos + 8]), 37u);
+            EXPECT_EQ(readBigEndian32(&data[pos + 12]), 21u);
+        }
+
+        pos += 12 + length;
+    }
+    
+    EXPECT_EQ(pos, data.size());
+    ASSERT_GE(types.size(), 3u);
+    EXPECT_EQ(types.front(), "IHDR");
+    EXPECT_EQ(types[1], "IDAT");
+    EXPECT_EQ(types.back(), "IEND");
+}
+
+TEST_F(ImageWriterTest, SavePNG_CompressesFlatImages) {
+    RasterCanvas canvas(400, 300);
+    canvas.clear(RasterCanvas::packColor(245, 245, 245));
+    ASSERT_TRUE(ImageWriter::save(canvas, pngFile_, ImageFormat::PNG));
+    
+    EXPECT_LT(readFile(pngFile_).size(), 400u * 300u * 3u / 50u);
+}
+
+TEST_F(ImageWriterTest, WriteRows_InBands_MatchesSingleSave) {
+    RasterCanvas canvas = makeCanvas();
+    ASSERT_TRUE(ImageWriter::save(canvas, pngFile_, ImageFormat::PNG));
+    auto whole = readFile(pngFile_);
+    
+    ImageWriter writer;
+    ASSERT_TRUE(writer.open(pngFile_, ImageFormat::PNG, 37, 21));
+    EXPECT_TRUE(writer.writeRows(canvas.getPixels().data(), 8));
+    EXPECT_TRUE(writer.writeRows(canvas.row(8), 13));
+    EXPECT_TRUE(writer.close());
+    
+    EXPECT_EQ(readFile(pngFile_), whole);
+}
+
+TEST_F(ImageWriterTest, Close_MissingRows_ReturnsFalse) {
+    ImageWriter writer;
+    ASSERT_TRUE(writer.open(ppmFile_, ImageFormat::PPM, 4, 4));
+    RasterCanvas band(4, 2);
+    writer.writeRows(band);
+    
+    EXPECT_FALSE(writer.close());
+}
+
+TEST_F(ImageWriterTest, Open_InvalidPath_ReturnsFalse) {
+    ImageWriter writer;
+    
+    EXPECT_FALSE(writer.open("/nonexistent/dir/x.png", ImageFormat::PNG, 4, 4));
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "view/LayoutEngine.hpp"
+#include "view/SlideLayout.hpp"
+#include "view/SvgGenerator.hpp"
+#include "model/Slide.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/shapes/Shape.hpp"
+
+using namespace slideEditor::view;
+using namespace slideEditor::model;
+using slideEditor::core::ShapeType;
+
+class LayoutEngineTest : public ::testing::Test {
+protected:
+    LayoutEngine engine_;
+
+    static std::unique_ptr<Slide> makeSlide(int id, size_t shapeCount, double scale) {
+        auto slide = std::make_unique<Slide>(id, "Title", "Content", "default");
+        for (size_t i = 0; i < shapeCount; ++i) {
+            slide->addShape(std::make_unique<Shape>(ShapeType::ELLIPSE, scale));
+        }
+        return slide;
+    }
+};
+
+TEST_F(LayoutEngineTest, Grid_MatchesSlideLayout) {
+    auto slide = makeSlide(1, 7, 0.5);
+
+    const auto& placements = engine_.layout(slide.get());
+
+    ASSERT_EQ(placements.size(), 7);
+    for (size_t i = 0; i < placements.size(); ++i) {
+        double x = 0;
+        double y = 0;
+        SlideLayout::shapeCenter(i, 7, 0, x, y);
+        EXPECT_DOUBLE_EQ(placements[i].x, x);
+        EXPECT_DOUBLE_EQ(placements[i].y, y);
+        EXPECT_TRUE(placements[i].bounds.contains(x, y));
+    }
+}
+
+TEST_F(LayoutEngineTest, Layout_CachedUntilSlideMutates) {
+    auto slide = makeSlide(1, 3, 1.0);
+
+    engine_.layout(slide.get());
+    engine_.layout(slide.get());
+    EXPECT_EQ(engine_.getMissCount(), 1);
+    EXPECT_EQ(engine_.getHitCount(), 1);
+
+    slide->addShape(std::make_unique<Shape>(ShapeType::CIRCLE));
+    EXPECT_EQ(engine_.layout(slide.get()).size(), 4);
+    EXPECT_EQ(engine_.getMissCount(), 2);
+
+    // A different mode is a different layout
+    engine_.layout(slide.get(), LayoutMode::PACKED);
+    EXPECT_EQ(engine_.getMissCount(), 3);
+    EXPECT_EQ(engine_.getEntryCount(), 1);
+}
+
+TEST_F(LayoutEngineTest, Prune_DropsSlidesNotLaidOutSinceLastPrune) {
+    auto kept = makeSlide(1, 2, 1.0);
+    auto removed = makeSlide(2, 2, 1.0);
+    engine_.layout(kept.get());
+    engine_.layout(removed.get());
+    engine_.prune();
+    EXPECT_EQ(engine_.getEntryCount(), 2);
+
+    engine_.layout(kept.get());
+    engine_.prune();
+
+    EXPECT_EQ(engine_.getEntryCount(), 1);
+    EXPECT_EQ(engine_.getHitCount(), 1);
+}
+
+TEST_F(LayoutEngineTest, Grid_LargeShapesOverlap_PackedDoesNot) {
+    auto slide = makeSlide(1, 8, 1.5);  // 225 wide, far wider than the grid spacing
+
+    EXPECT_FALSE(engine_.findOverlaps(slide.get()).empty());
+    EXPECT_TRUE(engine_.findOverlaps(slide.get(), LayoutMode::PACKED).empty());
+
+    for (const auto& placement : engine_.layout(slide.get(), LayoutMode::PACKED)) {
+        EXPECT_GE(placement.bounds.x, 0.0);
+        EXPECT_LE(placement.bounds.x + placement.bounds.width, SlideLayout::SLIDE_WIDTH);
+    }
+}
+
+TEST_F(LayoutEngineTest, Packed_ShrinksToStayInsideSlideFrame) {
+    auto many = makeSlide(1, 12, 2.0);   // Rows would run to twice the slide height
+    auto huge = makeSlide(2, 1, 12.0);   // One shape wider than the slide
+
+    for (const auto* slide : {many.get(), huge.get()}) {
+        const auto& placements = engine_.layout(slide, LayoutMode::PACKED);
+        for (const auto& placement : placements) {
+            EXPECT_LT(placement.scale, 1.0);
+            EXPECT_GE(placement.bounds.x, 10.0);
+            EXPECT_GE(placement.bounds.y, 10.0);
+            EXPECT_LE(placement.bounds.x + placement.bounds.width, SlideLayout::SLIDE_WIDTH - 10.0);
+            EXPECT_LE(placement.bounds.y + placement.bounds.height, SlideLayout::SLIDE_HEIGHT - 10.0);
+        }
+        EXPECT_TRUE(engine_.findOverlaps(slide, LayoutMode::PACKED).empty());
+    }
+
+    // Bounds are those of the shape drawn at the placement's scale
+    const ShapePlacement& placement = engine_.layout(huge.get(), LayoutMode::PACKED)[0];
+    const BoundingBox drawn = Shape(ShapeType::ELLIPSE, 12.0 * placement.scale)
+                                  .getBounds(placement.x, placement.y);
+    EXPECT_NEAR(drawn.x, placement.bounds.x, 1e-9);
+    EXPECT_NEAR(drawn.width, placement.bounds.width, 1e-9);
+}
+
+TEST_F(LayoutEngineTest, Packed_AnchorsTriangleByCentroid) {
+    Slide slide(1, "Title", "Content", "default");
+    slide.addShape(std::make_unique<Shape>(ShapeType::TRIANGLE, 2.0));
+
+    const ShapePlacement& placement = engine_.layout(&slide, LayoutMode::PACKED)[0];
+    const BoundingBox drawn = Shape(ShapeType::TRIANGLE, 2.0).getBounds(placement.x, placement.y);
+
+    EXPECT_DOUBLE_EQ(drawn.x, placement.bounds.x);
+    EXPECT_DOUBLE_EQ(drawn.y, placement.bounds.y);
+}
+
+TEST_F(LayoutEngineTest, HitTest_FindsShapeUnderPoint) {
+    auto slide = makeSlide(1, 2, 0.5);
+    const auto& placements = engine_.layout(slide.get());
+
+    EXPECT_EQ(engine_.hitTest(slide.get(), placements[1].x, placements[1].y), 1);
+    EXPECT_EQ(engine_.hitTest(slide.get(), 5, 5), -1);
+}
+
+TEST_F(LayoutEngineTest, PackedSvg_UsesPackedPositions) {
+    SlideRepository repository;
+    repository.addSlide(makeSlide(0, 2, 1.5));
+    SvgOptions options;
+    ASSERT_TRUE(SvgGenerator::parseMode("packed", options));
+
+    std::string svg = SvgGenerator::generateSVG(&repository, nullptr, options);
+
+    const auto* slide = repository.getAllSlides()[0].get();
+    const ShapePlacement second = engine_.layout(slide, LayoutMode::PACKED)[1];
+    EXPECT_NE(svg.find(slide->getShapes()[1]->toSVG(second.x, second.y)), std::string::npos);
+    EXPECT_EQ(options.layout, LayoutMode::PACKED);
+    EXPECT_FALSE(options.shapeDefs);
+}
+
+TEST_F(LayoutEngineTest, PackedSvg_DrawsShrunkShapesScaled) {
+    SlideRepository repository;
+    repository.addSlide(makeSlide(0, 12, 2.0));
+    SvgOptions options;
+    options.layout = LayoutMode::PACKED;
+
+    const std::string svg = SvgGenerator::generateSVG(&repository, nullptr, options);
+    options.shapeDefs = true;
+    const std::string defs = SvgGenerator::generateSVG(&repository, nullptr, options);
+
+    EXPECT_NE(svg.find("<g transform=\"translate("), std::string::npos);
+    EXPECT_NE(defs.find("<use href=\"#shape-0\" transform=\"translate("), std::string::npos);
+}
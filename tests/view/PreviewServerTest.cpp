@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include "view/PreviewServer.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+#include <chrono>
+#include <thread>
+
+#ifndef _WIN32
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+using namespace slideEditor;
+using namespace slideEditor::view;
+
+#ifndef _WIN32
+
+class PreviewServerTest : public ::testing::Test {
+protected:
+    model::SlideRepository repository_;
+    PreviewServer server_;
+    std::vector<int> sockets_;
+    
+    void SetUp() override {
+        ASSERT_TRUE(server_.start(0));
+    }
+    
+    void TearDown() override {
+        for (int fd : sockets_) {
+            ::close(fd);
+        }
+        server_.stop();
+    }
+    
+    int connectAndSend(const std::string& request) {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(static_cast<uint16_t>(server_.getPort()));
+        EXPECT_EQ(::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+        EXPECT_EQ(::send(fd, request.data(), request.size(), 0), static_cast<ssize_t>(request.size()));
+        sockets_.push_back(fd);
+        
+        return fd;
+    }
+    
+    // Reads until needle has arrived or the timeout passes
+    std::string readUntil(int fd, const std::string& needle, int timeoutMs = 2000) {
+        std::string data;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        char buffer[4096];
+        while (data.find(needle) == std::string::npos && std::chrono::steady_clock::now() < deadline) {
+            pollfd pfd{fd, POLLIN, 0};
+            if (::poll(&pfd, 1, 50) <= 0) {
+                continue;
+            }
+            
+            ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                break;
+            }
+            data.append(buffer, static_cast<size_t>(received));
+        }
+        
+        return data;
+    }
+    
+    // Opens a stream and consumes its snapshot up to until
+    int openEventStream(const std::string& until = "event: deck") {
+        int fd = connectAndSend("GET /events HTTP/1.1\r\nHost: localhost\r\n\r\n");
+        readUntil(fd, until);
+        for (int i = 0; i < 100 && server_.getClientCount() == 0; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        
+        return fd;
+    }
+    
+    int addSlide(const std::string& title) {
+        return repository_.addSlide(model::SlideFactory::createSlide(0, title, "Content", "default"));
+    }
+};
+
+TEST_F(PreviewServerTest, Start_PicksFreePortOnLoopback) {
+    EXPECT_TRUE(server_.isRunning());
+    EXPECT_GT(server_.getPort(), 0);
+    EXPECT_EQ(server_.getUrl(), "http://127.0.0.1:" + std::to_string(server_.getPort()) + "/");
+}
+
+TEST_F(PreviewServerTest, ServesPage) {
+    int fd = connectAndSend("GET / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    std::string reply = readUntil(fd, "</html>");
+    
+    EXPECT_EQ(reply.rfind("HTTP/1.1 200 OK", 0), 0u);
+    EXPECT_NE(reply.find("text/html"), std::string::npos);
+    EXPECT_NE(reply.find("new EventSource('/events')"), std::string::npos);
+}
+
+TEST_F(PreviewServerTest, UnknownPath_Returns404) {
+    int fd = connectAndSend("GET /missing HTTP/1.1\r\n\r\n");
+    
+    EXPECT_EQ(readUntil(fd, "\r\n\r\n").rfind("HTTP/1.1 404", 0), 0u);
+}
+
+TEST_F(PreviewServerTest, EventStream_StartsWithSnapshot) {
+    addSlide("First");
+    addSlide("Second");
+    server_.publish(&repository_);
+    
+    int fd = connectAndSend("GET /events HTTP/1.1\r\n\r\n");
+    std::string stream = readUntil(fd, "Second");
+    
+    EXPECT_NE(stream.find("text/event-stream"), std::string::npos);
+    EXPECT_NE(stream.find("event: deck\ndata: 2\n\n"), std::string::npos);
+    EXPECT_NE(stream.find("event: slide\ndata: 0\n"), std::string::npos);
+    EXPECT_NE(stream.find("event: slide\ndata: 1\n"), std::string::npos);
+    EXPECT_NE(stream.find(">First</text>"), std::string::npos);
+}
+
+TEST_F(PreviewServerTest, Publish_SendsOnlyChangedSlides) {
+    addSlide("First");
+    int second = addSlide("Second");
+    server_.publish(&repository_);
+    int fd = openEventStream("Second");
+    
+    EXPECT_EQ(server_.publish(&repository_), 0u);
+    
+    repository_.getSlide(second)->addShape(model::SlideFactory::createShape("circle", 1.0));
+    EXPECT_EQ(server_.publish(&repository_), 1u);
+    std::string update = readUntil(fd, "</g>");
+    
+    EXPECT_EQ(update.rfind("event: slide\ndata: 1\n", 0), 0u);
+    EXPECT_NE(update.find("<circle"), std::string::npos);
+    EXPECT_EQ(update.find("First"), std::string::npos);
+}
+
+TEST_F(PreviewServerTest, Publish_AnnouncesDeckSizeChanges) {
+    addSlide("First");
+    server_.publish(&repository_);
+    int fd = openEventStream("First");
+    
+    addSlide("Added");
+    EXPECT_EQ(server_.publish(&repository_), 1u);
+    std::string update = readUntil(fd, "Added");
+    
+    EXPECT_EQ(update.rfind("event: deck\ndata: 2\n\n", 0), 0u);
+    EXPECT_NE(update.find("event: slide\ndata: 1\n"), std::string::npos);
+}
+
+TEST_F(PreviewServerTest, Stop_ClosesStreamsAndAllowsRestart) {
+    int fd = openEventStream();
+    EXPECT_EQ(server_.getClientCount(), 1u);
+    
+    server_.stop();
+    EXPECT_FALSE(server_.isRunning());
+    char byte;
+    EXPECT_EQ(::recv(fd, &byte, 1, 0), 0);
+    
+    EXPECT_TRUE(server_.start(0));
+}
+
+#else
+
+TEST(PreviewServerTest, UnsupportedPlatform) {
+    PreviewServer server;
+    EXPECT_FALSE(server.start(0));
+}
+
+#endif
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include "view/raster/RasterCanvas.hpp"
+
+using namespace slideEditor::view;
+
+class RasterCanvasTest : public ::testing::Test {
+protected:
+    const std::uint32_t red_ = RasterCanvas::packColor(255, 0, 0);
+    const std::uint32_t blue_ = RasterCanvas::packColor(0, 0, 255);
+};
+
+TEST_F(RasterCanvasTest, Constructor_SetsDimensionsAndOrigin) {
+    RasterCanvas canvas(16, 8, 100, 200);
+    
+    EXPECT_EQ(canvas.getWidth(), 16);
+    EXPECT_EQ(canvas.getHeight(), 8);
+    EXPECT_EQ(canvas.getOriginX(), 100);
+    EXPECT_EQ(canvas.getOriginY(), 200);
+    EXPECT_EQ(canvas.getPixels().size(), 128u);
+}
+
+TEST_F(RasterCanvasTest, PackColor_RoundTripsChannels) {
+    std::uint32_t color = RasterCanvas::packColor(1, 2, 3, 4);
+    
+    EXPECT_EQ(RasterCanvas::red(color), 1);
+    EXPECT_EQ(RasterCanvas::green(color), 2);
+    EXPECT_EQ(RasterCanvas::blue(color), 3);
+    EXPECT_EQ(RasterCanvas::alpha(color), 4);
+}
+
+TEST_F(RasterCanvasTest, Clear_FillsEveryPixel) {
+    RasterCanvas canvas(13, 3);
+    canvas.clear(red_);
+    
+    for (std::uint32_t pixel : canvas.getPixels()) {
+        EXPECT_EQ(pixel, red_);
+    }
+}
+
+TEST_F(RasterCanvasTest, FillSpan_TouchesOnlyTheSpan) {
+    RasterCanvas canvas(20, 2);
+    canvas.clear(blue_);
+    canvas.fillSpan(1, 3, 14, red_);  // Crosses vector and scalar tails
+    
+    for (int x = 0; x < 20; ++x) {
+        EXPECT_EQ(canvas.getPixel(x, 0), blue_);
+        EXPECT_EQ(canvas.getPixel(x, 1), (x >= 3 && x < 14) ? red_ : blue_) << x;
+    }
+}
+
+TEST_F(RasterCanvasTest, BlendSpan_MatchesBlendPixel) {
+    RasterCanvas spans(11, 1);
+    RasterCanvas pixels(11, 1);
+    spans.clear(blue_);
+    pixels.clear(blue_);
+    
+    spans.blendSpan(0, 0, 11, red_, 77);
+    for (int x = 0; x < 11; ++x) {
+        pixels.blendPixel(x, 0, red_, 77);
+    }
+    
+    EXPECT_EQ(spans.getPixels(), pixels.getPixels());
+    EXPECT_EQ(RasterCanvas::red(spans.getPixel(0, 0)), 77);
+    EXPECT_EQ(RasterCanvas::blue(spans.getPixel(0, 0)), 178);
+}
+
+TEST_F(RasterCanvasTest, BlendSpan_AlphaExtremes) {
+    RasterCanvas canvas(8, 1);
+    canvas.clear(blue_);
+    
+    canvas.blendSpan(0, 0, 8, red_, 0);
+    EXPECT_EQ(canvas.getPixel(4, 0), blue_);
+    
+    canvas.blendSpan(0, 0, 8, red_, 255);
+    EXPECT_EQ(canvas.getPixel(4, 0), red_);
+}
+
+TEST_F(RasterCanvasTest, View_WritesThroughToTarget) {
+    RasterCanvas target(10, 6, 0, 100);
+    target.clear(blue_);
+    
+    RasterCanvas window = RasterCanvas::view(target, 4, 2, 3, 2);
+    EXPECT_TRUE(window.isView());
+    EXPECT_EQ(window.getOriginX(), 4);
+    EXPECT_EQ(window.getOriginY(), 102);
+    
+    window.clear(red_);
+    EXPECT_EQ(target.getPixel(4, 2), red_);
+    EXPECT_EQ(target.getPixel(6, 3), red_);
+    EXPECT_EQ(target.getPixel(7, 3), blue_);
+    EXPECT_EQ(target.getPixel(4, 4), blue_);
+    
+    RasterCanvas copy = target;
+    copy.clear(blue_);
+    EXPECT_EQ(target.getPixel(4, 2), red_);
+}
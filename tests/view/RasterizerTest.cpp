@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "view/raster/Rasterizer.hpp"
+#include "view/raster/RasterRenderer.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+
+using namespace slideEditor::view;
+using namespace slideEditor;
+
+class RasterizerTest : public ::testing::Test {
+protected:
+    const std::uint32_t white_ = RasterCanvas::packColor(255, 255, 255);
+    const std::uint32_t red_ = RasterCanvas::packColor(255, 0, 0);
+    const std::uint32_t black_ = RasterCanvas::packColor(0, 0, 0);
+    
+    RasterShape makeShape(core::ShapeType type, double rx, double ry) {
+        return RasterShape{type, 50.0, 50.0, rx, ry, red_, black_, 2.0};
+    }
+};
+
+TEST_F(RasterizerTest, SignedDistance_Circle) {
+    auto circle = makeShape(core::ShapeType::CIRCLE, 20, 20);
+    
+    EXPECT_DOUBLE_EQ(Rasterizer::signedDistance(circle, 50, 50), -20.0);
+    EXPECT_DOUBLE_EQ(Rasterizer::signedDistance(circle, 80, 50), 10.0);
+}
+
+TEST_F(RasterizerTest, SignedDistance_Rectangle) {
+    auto rect = makeShape(core::ShapeType::RECTANGLE, 20, 10);
+    
+    EXPECT_DOUBLE_EQ(Rasterizer::signedDistance(rect, 50, 50), -10.0);
+    EXPECT_DOUBLE_EQ(Rasterizer::signedDistance(rect, 75, 50), 5.0);
+    EXPECT_DOUBLE_EQ(Rasterizer::signedDistance(rect, 73, 64), 5.0);  // Corner: (3, 4)
+}
+
+TEST_F(RasterizerTest, SignedDistance_TriangleAndEllipseSigns) {
+    auto triangle = makeShape(core::ShapeType::TRIANGLE, 20, 34);
+    auto ellipse = makeShape(core::ShapeType::ELLIPSE, 30, 10);
+    
+    EXPECT_LT(Rasterizer::signedDistance(triangle, 50, 50), 0.0);
+    EXPECT_GT(Rasterizer::signedDistance(triangle, 50, 10), 0.0);
+    EXPECT_LT(Rasterizer::signedDistance(ellipse, 75, 50), 0.0);
+    EXPECT_GT(Rasterizer::signedDistance(ellipse, 50, 65), 0.0);
+}
+
+TEST_F(RasterizerTest, Bounds_IncludeStrokeMargin) {
+    auto circle = makeShape(core::ShapeType::CIRCLE, 20, 20);
+    RasterBounds box = Rasterizer::bounds(circle);
+    
+    EXPECT_DOUBLE_EQ(box.left, 28.0);
+    EXPECT_DOUBLE_EQ(box.right, 72.0);
+    EXPECT_DOUBLE_EQ(box.top, 28.0);
+    EXPECT_DOUBLE_EQ(box.bottom, 72.0);
+}
+
+TEST_F(RasterizerTest, Draw_FillsInteriorStrokesEdgeLeavesOutside) {
+    RasterCanvas canvas(100, 100);
+    canvas.clear(white_);
+    Rasterizer::draw(canvas, makeShape(core::ShapeType::CIRCLE, 20, 20));
+    
+    EXPECT_EQ(canvas.getPixel(50, 50), red_);
+    EXPECT_EQ(canvas.getPixel(5, 5), white_);
+    EXPECT_LT(RasterCanvas::red(canvas.getPixel(50, 29)), 8);  // Center 29.5 sits on the stroke
+}
+
+TEST_F(RasterizerTest, Draw_AntiAliasesEdges) {
+    RasterCanvas canvas(100, 100);
+    canvas.clear(white_);
+    auto circle = makeShape(core::ShapeType::CIRCLE, 20, 20);
+    circle.strokeWidth = 0;
+    Rasterizer::draw(canvas, circle);
+    
+    // Row 40 crosses the boundary between pixel centers, near x = 32.4
+    bool sawPartial = false;
+    for (int x = 0; x < 50; ++x) {
+        std::uint8_t green = RasterCanvas::green(canvas.getPixel(x, 40));
+        sawPartial = sawPartial || (green > 0 && green < 255);
+    }
+    
+    EXPECT_TRUE(sawPartial);
+}
+
+TEST_F(RasterizerTest, Draw_WindowedCanvasMatchesFullCanvas) {
+    auto ellipse = makeShape(core::ShapeType::ELLIPSE, 30, 15);
+    RasterCanvas full(100, 100);
+    RasterCanvas window(40, 30, 40, 30);
+    full.clear(white_);
+    window.clear(white_);
+    
+    Rasterizer::draw(full, ellipse);
+    Rasterizer::draw(window, ellipse);
+    
+    for (int y = 0; y < 30; ++y) {
+        for (int x = 0; x < 40; ++x) {
+            ASSERT_EQ(window.getPixel(x, y), full.getPixel(x + 40, y + 30)) << x << "," << y;
+        }
+    }
+}
+
+TEST_F(RasterizerTest, Draw_ShapeOutsideCanvas_IsNoOp) {
+    RasterCanvas canvas(10, 10);
+    canvas.clear(white_);
+    auto circle = makeShape(core::ShapeType::CIRCLE, 20, 20);
+    circle.cx = 500;
+    Rasterizer::draw(canvas, circle);
+    
+    for (std::uint32_t pixel : canvas.getPixels()) {
+        EXPECT_EQ(pixel, white_);
+    }
+}
+
+TEST_F(RasterizerTest, RasterRenderer_BuildsFrameAndShapes) {
+    model::SlideRepository repository;
+    auto slide = model::SlideFactory::createSlide(0, "T", "C", "default");
+    slide->addShape(model::SlideFactory::createShape("circle", 1.0, "black", "red"));
+    slide->addShape(model::SlideFactory::createShape("triangle", 1.0));
+    repository.addSlide(std::move(slide));
+    
+    auto scene = RasterRenderer::buildScene(&repository, 0, 1);
+    
+    ASSERT_EQ(scene.size(), 3u);  // Frame + 2 shapes
+    EXPECT_EQ(scene[1].type, core::ShapeType::CIRCLE);
+    EXPECT_DOUBLE_EQ(scene[1].cx, 100.0);
+    EXPECT_DOUBLE_EQ(scene[1].cy, 150.0);
+    EXPECT_DOUBLE_EQ(scene[1].rx, 50.0);
+    EXPECT_EQ(scene[1].fill, red_);
+}
+
+TEST_F(RasterizerTest, RasterRenderer_PackedLayoutMatchesSvgPlacement) {
+    model::SlideRepository repository;
+    auto slide = model::SlideFactory::createSlide(0, "T", "C", "default");
+    for (int i = 0; i < 6; ++i) {
+        slide->addShape(model::SlideFactory::createShape("circle", 3.0));  // Packing must shrink
+    }
+    repository.addSlide(std::move(slide));
+    LayoutEngine engine;
+    const auto& placements = engine.layout(repository.getAllSlides()[0].get(), LayoutMode::PACKED);
+    
+    auto scene = RasterRenderer::buildScene(&repository, 0, 1, LayoutMode::PACKED);
+    
+    ASSERT_EQ(scene.size(), 7u);
+    for (size_t i = 0; i < placements.size(); ++i) {
+        EXPECT_DOUBLE_EQ(scene[i + 1].cx, placements[i].x);
+        EXPECT_DOUBLE_EQ(scene[i + 1].cy, placements[i].y);
+        EXPECT_DOUBLE_EQ(scene[i + 1].rx * 2, placements[i].bounds.width);
+    }
+}
+
+TEST_F(RasterizerTest, RasterRenderer_RenderSizesCanvasToRange) {
+    model::SlideRepository repository;
+    for (int i = 0; i < 4; ++i) {
+        repository.addSlide(model::SlideFactory::createSlide(0, "T", "C", "default"));
+    }
+    
+    RasterCanvas canvas = RasterRenderer::render(&repository, 1, 3);
+    
+    EXPECT_EQ(canvas.getWidth(), 800);
+    EXPECT_EQ(canvas.getHeight(), 1300);
+    EXPECT_EQ(canvas.getPixel(0, 0), RasterRenderer::BACKGROUND);
+    EXPECT_EQ(canvas.getPixel(400, 300), white_);  // Inside the first slide frame
+}
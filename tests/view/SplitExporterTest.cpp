@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "view/SplitExporter.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace slideEditor;
+using namespace slideEditor::view;
+
+class SplitExporterTest : public ::testing::Test {
+protected:
+    model::SlideRepository repository_;
+    SplitExporter exporter_;
+    WorkStealingPool pool_{2};
+    std::string directory_ = "test_split_export";
+    
+    void TearDown() override {
+        std::filesystem::remove_all(directory_);
+    }
+    
+    std::vector<int> addSlides(int count) {
+        std::vector<int> ids;
+        for (int i = 0; i < count; ++i) {
+            auto slide = model::SlideFactory::createSlide(0, "Title" + std::to_string(i), "C", "T");
+            slide->addShape(model::SlideFactory::createShape("circle", 1.0));
+            ids.push_back(repository_.addSlide(std::move(slide)));
+        }
+        
+        return ids;
+    }
+    
+    std::string readFile(const std::string& name) {
+        std::ifstream file(directory_ + "/" + name);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    
+    SplitExportStats exportNow() {
+        SplitExportStats stats;
+        EXPECT_TRUE(exporter_.exportSlides(&repository_, directory_, SvgOptions(), stats, &pool_));
+        return stats;
+    }
+};
+
+TEST_F(SplitExporterTest, WritesOneFilePerSlideAndIndex) {
+    auto ids = addSlides(3);
+    
+    SplitExportStats stats = exportNow();
+    
+    EXPECT_EQ(stats.written, 3u);
+    EXPECT_EQ(stats.unchanged, 0u);
+    std::string index = readFile(SplitExporter::INDEX_FILENAME);
+    for (int id : ids) {
+        std::string name = SplitExporter::slideFilename(id);
+        std::string svg = readFile(name);
+        EXPECT_EQ(svg.rfind("<?xml", 0), 0u) << name;
+        EXPECT_NE(svg.find("cy=\"150\""), std::string::npos) << "offset not normalized in " << name;
+        EXPECT_NE(index.find("src=\"" + name + "\""), std::string::npos);
+    }
+}
+
+TEST_F(SplitExporterTest, ReexportSkipsUnchangedSlides) {
+    auto ids = addSlides(3);
+    exportNow();
+    
+    repository_.getSlide(ids[1])->addShape(model::SlideFactory::createShape("rectangle", 1.0));
+    SplitExportStats stats = exportNow();
+    
+    EXPECT_EQ(stats.written, 1u);
+    EXPECT_EQ(stats.unchanged, 2u);
+    EXPECT_NE(readFile(SplitExporter::slideFilename(ids[1])).find("height=\"60\""), std::string::npos);
+}
+
+TEST_F(SplitExporterTest, RewritesMissingFilesAndRemovesDeletedSlides) {
+    auto ids = addSlides(3);
+    exportNow();
+    
+    std::filesystem::remove(directory_ + "/" + SplitExporter::slideFilename(ids[0]));
+    repository_.removeSlide(ids[2]);
+    SplitExportStats stats = exportNow();
+    
+    EXPECT_EQ(stats.written, 1u);
+    EXPECT_EQ(stats.unchanged, 1u);
+    EXPECT_EQ(stats.removed, 1u);
+    EXPECT_TRUE(std::filesystem::exists(directory_ + "/" + SplitExporter::slideFilename(ids[0])));
+    EXPECT_FALSE(std::filesystem::exists(directory_ + "/" + SplitExporter::slideFilename(ids[2])));
+    EXPECT_EQ(readFile(SplitExporter::INDEX_FILENAME).find(SplitExporter::slideFilename(ids[2])),
+              std::string::npos);
+}
+
+TEST_F(SplitExporterTest, ModeChangeRewritesEverything) {
+    addSlides(2);
+    exportNow();
+    
+    SvgOptions classes;
+    classes.styleClasses = true;
+    SplitExportStats stats;
+    ASSERT_TRUE(exporter_.exportSlides(&repository_, directory_, classes, stats, &pool_));
+    
+    EXPECT_EQ(stats.written, 2u);
+    EXPECT_EQ(stats.unchanged, 0u);
+}
+
+TEST_F(SplitExporterTest, LayoutChangeRewritesEverything) {
+    auto ids = addSlides(2);
+    for (int id : ids) {
+        repository_.getSlide(id)->addShape(model::SlideFactory::createShape("rectangle", 3.0));
+    }
+    exportNow();
+    const std::string grid = readFile(SplitExporter::slideFilename(ids[0]));
+    
+    SvgOptions packed;
+    packed.layout = LayoutMode::PACKED;
+    SplitExportStats stats;
+    ASSERT_TRUE(exporter_.exportSlides(&repository_, directory_, packed, stats, &pool_));
+    
+    EXPECT_EQ(stats.written, 2u);
+    EXPECT_EQ(stats.unchanged, 0u);
+    EXPECT_NE(readFile(SplitExporter::slideFilename(ids[0])), grid);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "view/SvgFragmentCache.hpp"
+#include "view/SvgGenerator.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+
+using namespace slideEditor::view;
+using namespace slideEditor::model;
+
+class SvgFragmentCacheTest : public ::testing::Test {
+protected:
+    SlideRepository repository_;
+    SvgFragmentCache cache_;
+};
+
+TEST_F(SvgFragmentCacheTest, Find_EmptyCache_Misses) {
+    EXPECT_EQ(cache_.find(1, 1, 0), nullptr);
+    EXPECT_EQ(cache_.getMissCount(), 1);
+}
+
+TEST_F(SvgFragmentCacheTest, Store_ThenFind_Hits) {
+    cache_.store(1, 7, 0, "<g/>");
+    
+    const std::string* fragment = cache_.find(1, 7, 0);
+    
+    ASSERT_NE(fragment, nullptr);
+    EXPECT_EQ(*fragment, "<g/>");
+    EXPECT_EQ(cache_.getHitCount(), 1);
+    EXPECT_EQ(cache_.getMemoryUsage(), 4);
+}
+
+TEST_F(SvgFragmentCacheTest, Find_DifferentVersionOrPosition_Misses) {
+    cache_.store(1, 7, 0, "<g/>");
+    
+    EXPECT_EQ(cache_.find(1, 8, 0), nullptr);
+    EXPECT_EQ(cache_.find(1, 7, 1), nullptr);
+}
+
+TEST_F(SvgFragmentCacheTest, Store_OverBudget_EvictsLeastRecentlyUsed) {
+    SvgFragmentCache cache(10);
+    cache.store(1, 1, 0, "aaaa");
+    cache.store(2, 1, 1, "bbbb");
+    cache.find(1, 1, 0);              // 1 becomes most recently used
+    cache.store(3, 1, 2, "cccc");     // evicts 2
+    
+    EXPECT_NE(cache.find(1, 1, 0), nullptr);
+    EXPECT_EQ(cache.find(2, 1, 1), nullptr);
+    EXPECT_NE(cache.find(3, 1, 2), nullptr);
+    EXPECT_LE(cache.getMemoryUsage(), 10);
+}
+
+TEST_F(SvgFragmentCacheTest, Store_FragmentLargerThanBudget_IsNotCached) {
+    SvgFragmentCache cache(2);
+    cache.store(1, 1, 0, "too large");
+    
+    EXPECT_EQ(cache.getEntryCount(), 0);
+    EXPECT_EQ(cache.getMemoryUsage(), 0);
+}
+
+TEST_F(SvgFragmentCacheTest, SetMemoryBudget_ShrinksCache) {
+    cache_.store(1, 1, 0, "aaaa");
+    cache_.store(2, 1, 1, "bbbb");
+    
+    cache_.setMemoryBudget(4);
+    
+    EXPECT_EQ(cache_.getEntryCount(), 1);
+    EXPECT_EQ(cache_.getMemoryBudget(), 4);
+}
+
+TEST_F(SvgFragmentCacheTest, GenerateSVG_RepeatedDraw_RendersOnlyDirtySlides) {
+    repository_.addSlide(SlideFactory::createSlide(0, "S1", "C1", "T1"));
+    int id2 = repository_.addSlide(SlideFactory::createSlide(0, "S2", "C2", "T2"));
+    
+    std::string first = SvgGenerator::generateSVG(&repository_, &cache_);
+    EXPECT_EQ(cache_.getMissCount(), 2);
+    
+    std::string second = SvgGenerator::generateSVG(&repository_, &cache_);
+    EXPECT_EQ(cache_.getHitCount(), 2);
+    EXPECT_EQ(first, second);
+    
+    repository_.getSlide(id2)->addShape(SlideFactory::createShape("circle", 1.0));
+    std::string third = SvgGenerator::generateSVG(&repository_, &cache_);
+    
+    EXPECT_EQ(cache_.getHitCount(), 3);   // slide 1 reused
+    EXPECT_EQ(cache_.getMissCount(), 3);  // slide 2 re-rendered
+    EXPECT_NE(third.find("<circle"), std::string::npos);
+    EXPECT_EQ(third, SvgGenerator::generateSVG(&repository_));
+}
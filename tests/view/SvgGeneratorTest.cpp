@@ -252,4 +252,169 @@ TEST_F(SvgGeneratorTest, GenerateSVG_ComplexPresentation_GeneratesCorrectly) {
     EXPECT_NE(svg.find("<rect"), std::string::npos);
     EXPECT_NE(svg.find("<polygon"), std::string::npos);
     EXPECT_NE(svg.find("<ellipse"), std::string::npos);
-}
\ No newline at end of file
+}
+
+TEST_F(SvgGeneratorTest, GenerateSVG_DefsMode_EmitsDefsAndUse) {
+    auto slide = SlideFactory::createSlide(0, "S1", "C1", "default");
+    slide->addShape(SlideFactory::createShape("circle", 1.0));
+    repository_.addSlide(std::move(slide));
+    
+    SvgOptions options;
+    options.shapeDefs = true;
+    std::string svg = SvgGenerator::generateSVG(&repository_, nullptr, options);
+    
+    EXPECT_NE(svg.find("<defs>"), std::string::npos);
+    EXPECT_NE(svg.find("<g id=\"shape-0\"><circle"), std::string::npos);
+    EXPECT_NE(svg.find("<use href=\"#shape-0\" x=\"100\" y=\"150\" />"), std::string::npos);
+}
+
+TEST_F(SvgGeneratorTest, GenerateSVG_DefsMode_DeduplicatesIdenticalShapes) {
+    for (int i = 0; i < 3; ++i) {
+        auto slide = SlideFactory::createSlide(0, "S", "C", "default");
+        slide->addShape(SlideFactory::createShape("circle", 1.0));
+        slide->addShape(SlideFactory::createShape("circle", 1.0));
+        slide->addShape(SlideFactory::createShape("rectangle", 2.0));
+        repository_.addSlide(std::move(slide));
+    }
+    
+    SvgOptions options;
+    options.shapeDefs = true;
+    std::string svg = SvgGenerator::generateSVG(&repository_, nullptr, options);
+    
+    auto count = [&svg](const std::string& needle) {
+        size_t n = 0;
+        for (size_t pos = svg.find(needle); pos != std::string::npos; pos = svg.find(needle, pos + 1)) {
+            ++n;
+        }
+        return n;
+    };
+    
+    EXPECT_EQ(count("<circle"), 1u);
+    EXPECT_EQ(count("\"><rect "), 1u);
+    EXPECT_EQ(count("<use "), 9u);
+    EXPECT_EQ(count("href=\"#shape-0\""), 6u);
+    EXPECT_EQ(count("href=\"#shape-1\""), 3u);
+}
+
+TEST_F(SvgGeneratorTest, GenerateSVG_PlainMode_HasNoDefs) {
+    auto slide = SlideFactory::createSlide(0, "S1", "C1", "default");
+    slide->addShape(SlideFactory::createShape("circle", 1.0));
+    repository_.addSlide(std::move(slide));
+    
+    std::string svg = SvgGenerator::generateSVG(&repository_, nullptr, SvgOptions());
+    
+    EXPECT_EQ(svg.find("<defs>"), std::string::npos);
+    EXPECT_EQ(svg.find("<use"), std::string::npos);
+    EXPECT_NE(svg.find("<circle"), std::string::npos);
+}
+
+TEST_F(SvgGeneratorTest, GenerateSVG_ClassesMode_SharesStyles) {
+    for (int i = 0; i < 3; ++i) {
+        auto slide = SlideFactory::createSlide(0, "S", "C", "default");
+        slide->addShape(SlideFactory::createShape("circle", 1.0));
+        auto red = SlideFactory::createShape("rectangle", 1.0);
+        red->setFillColor("red");
+        slide->addShape(std::move(red));
+        repository_.addSlide(std::move(slide));
+    }
+    
+    SvgOptions options;
+    options.styleClasses = true;
+    std::string svg = SvgGenerator::generateSVG(&repository_, nullptr, options);
+    
+    EXPECT_NE(svg.find("<style>"), std::string::npos);
+    EXPECT_NE(svg.find(".s0{fill:#ffffff;stroke:#000000;"), std::string::npos);
+    EXPECT_NE(svg.find(".s1{fill:#ff0000;"), std::string::npos);
+    EXPECT_EQ(svg.find(".s2{"), std::string::npos);
+    EXPECT_NE(svg.find("class=\"frame\""), std::string::npos);
+    EXPECT_EQ(svg.find("stroke-width=\""), std::string::npos);
+    EXPECT_NE(svg.find("<circle cx=\"100\" cy=\"150\" r=\"50\" class=\"s0\" />"), std::string::npos);
+    
+    std::string plain = SvgGenerator::generateSVG(&repository_);
+    EXPECT_LT(svg.size(), plain.size());
+}
+
+TEST_F(SvgGeneratorTest, GenerateSVG_CompactMode_DefsUseClasses) {
+    auto slide = SlideFactory::createSlide(0, "S1", "C1", "default");
+    slide->addShape(SlideFactory::createShape("circle", 1.0));
+    repository_.addSlide(std::move(slide));
+    
+    SvgOptions options;
+    ASSERT_TRUE(SvgGenerator::parseMode("compact", options));
+    std::string svg = SvgGenerator::generateSVG(&repository_, nullptr, options);
+    
+    EXPECT_NE(svg.find("<g id=\"shape-0\"><circle cx=\"0\" cy=\"0\" r=\"50\" class=\"s0\" /></g>"),
+              std::string::npos);
+    EXPECT_NE(svg.find("<use href=\"#shape-0\""), std::string::npos);
+}
+
+TEST_F(SvgGeneratorTest, GenerateSlideSVG_EscapesText) {
+    auto slide = SlideFactory::createSlide(0, "R&D <draft>", "\"quoted\"", "a'b");
+    
+    std::string svg = SvgGenerator::generateSlideSVG(slide.get(), 0);
+    
+    EXPECT_NE(svg.find(">R&amp;D &lt;draft&gt;</text>"), std::string::npos);
+    EXPECT_NE(svg.find(">&quot;quoted&quot;</text>"), std::string::npos);
+    EXPECT_NE(svg.find(">Theme: a&apos;b</text>"), std::string::npos);
+    EXPECT_EQ(svg.find("<draft>"), std::string::npos);
+}
+
+TEST_F(SvgGeneratorTest, ParseMode_AcceptsKnownModes) {
+    SvgOptions options;
+    
+    EXPECT_TRUE(SvgGenerator::parseMode("DEFS", options));
+    EXPECT_TRUE(options.shapeDefs);
+    EXPECT_TRUE(SvgGenerator::parseMode("plain", options));
+    EXPECT_FALSE(options.shapeDefs);
+    EXPECT_TRUE(SvgGenerator::parseMode("classes", options));
+    EXPECT_FALSE(options.shapeDefs);
+    EXPECT_TRUE(options.styleClasses);
+    EXPECT_TRUE(SvgGenerator::parseMode("compact", options));
+    EXPECT_TRUE(options.shapeDefs);
+    EXPECT_TRUE(options.styleClasses);
+    EXPECT_TRUE(SvgGenerator::parseMode("plain", options));
+    EXPECT_FALSE(options.styleClasses);
+    EXPECT_FALSE(SvgGenerator::parseMode("fancy", options));
+}
+
+TEST_F(SvgGeneratorTest, GenerateRangeSVG_IncludesOnlyRequestedSlides) {
+    for (int i = 1; i <= 5; ++i) {
+        repository_.addSlide(SlideFactory::createSlide(0, "Title" + std::to_string(i), "C", "T"));
+    }
+    
+    std::string svg = SvgGenerator::generateRangeSVG(&repository_, 1, 3);
+    
+    EXPECT_EQ(svg.find("Title1"), std::string::npos);
+    EXPECT_NE(svg.find("Title2"), std::string::npos);
+    EXPECT_NE(svg.find("Title3"), std::string::npos);
+    EXPECT_EQ(svg.find("Title4"), std::string::npos);
+    EXPECT_NE(svg.find("height=\"1300\""), std::string::npos);  // 2 * (600 + 50)
+}
+
+TEST_F(SvgGeneratorTest, GenerateRangeSVG_LaysOutFromTopOfDocument) {
+    for (int i = 1; i <= 3; ++i) {
+        repository_.addSlide(SlideFactory::createSlide(0, "Title" + std::to_string(i), "C", "T"));
+    }
+    
+    std::string range = SvgGenerator::generateRangeSVG(&repository_, 2, 3);
+    
+    // First slide of the range sits where slide 0 would
+    EXPECT_NE(range.find("<rect x=\"10\" y=\"10\""), std::string::npos);
+}
+
+TEST_F(SvgGeneratorTest, GenerateRangeSVG_EmptyOrOutOfBounds_ReturnsPlaceholder) {
+    repository_.addSlide(SlideFactory::createSlide(0, "Title", "C", "T"));
+    
+    EXPECT_NE(SvgGenerator::generateRangeSVG(&repository_, 1, 1).find("No slides to display"), 
+              std::string::npos);
+    EXPECT_NE(SvgGenerator::generateRangeSVG(&repository_, 5, 9).find("No slides to display"), 
+              std::string::npos);
+}
+
+TEST_F(SvgGeneratorTest, GenerateRangeSVG_FullRange_MatchesGenerateSVG) {
+    repository_.addSlide(SlideFactory::createSlide(0, "A", "C", "T"));
+    repository_.addSlide(SlideFactory::createSlide(0, "B", "C", "T"));
+    
+    EXPECT_EQ(SvgGenerator::generateRangeSVG(&repository_, 0, 2),
+              SvgGenerator::generateSVG(&repository_));
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include "view/SvgRenderer.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+#include <atomic>
+#include <functional>
+#include <cstdlib>
+#include <new>
+
+using namespace slideEditor;
+using namespace slideEditor::view;
+
+namespace {
+    std::atomic<bool> countAllocations{false};
+    std::atomic<size_t> allocationCount{0};
+}
+
+// Counts heap allocations made while countAllocations is set
+void* operator new(std::size_t size) {
+    if (countAllocations.load(std::memory_order_relaxed)) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+class SvgRendererTest : public ::testing::Test {
+protected:
+    model::SlideRepository repository_;
+    SvgRenderer renderer_;
+    
+    void fillRepository(int slideCount) {
+        static const char* types[] = {"circle", "rectangle", "triangle", "ellipse"};
+        static const char* fills[] = {"white", "orange", "blue"};
+        for (int i = 0; i < slideCount; ++i) {
+            // Titles longer than the small-string buffer would allocate if copied
+            auto slide = model::SlideFactory::createSlide(0, "Quarterly results & outlook " + std::to_string(i),
+                                                          "Content", "default");
+            for (int s = 0; s < i % 7; ++s) {
+                slide->addShape(model::SlideFactory::createShape(types[s % 4], 0.6 + 0.1 * s,
+                                                                 "black", fills[(i + s) % 3]));
+            }
+            
+            repository_.addSlide(std::move(slide));
+        }
+    }
+    
+    size_t allocationsDuring(const std::function<void()>& action) {
+        allocationCount = 0;
+        countAllocations = true;
+        action();
+        countAllocations = false;
+        
+        return allocationCount;
+    }
+};
+
+TEST_F(SvgRendererTest, Render_MatchesSvgGenerator) {
+    fillRepository(12);
+    
+    for (const char* mode : {"plain", "defs", "classes", "compact"}) {
+        SvgOptions options;
+        ASSERT_TRUE(SvgGenerator::parseMode(mode, options));
+        
+        EXPECT_EQ(renderer_.render(&repository_, 0, 12, nullptr, options),
+                  SvgGenerator::generateSVG(&repository_, nullptr, options)) << mode;
+        EXPECT_EQ(renderer_.render(&repository_, 3, 5, nullptr, options),
+                  SvgGenerator::generateRangeSVG(&repository_, 3, 5, nullptr, options)) << mode;
+    }
+}
+
+TEST_F(SvgRendererTest, Render_SteadyStateDoesNotAllocate) {
+    fillRepository(30);
+    SvgFragmentCache cache;
+    
+    // The counter sees the first draw's buffer growth
+    EXPECT_GT(allocationsDuring([&] { SvgRenderer().render(&repository_, 0, 30); }), 0u);
+    
+    for (const char* mode : {"plain", "defs", "classes", "compact"}) {
+        SvgOptions options;
+        ASSERT_TRUE(SvgGenerator::parseMode(mode, options));
+        for (SvgFragmentCache* useCache : {static_cast<SvgFragmentCache*>(nullptr), &cache}) {
+            renderer_.render(&repository_, 0, 30, useCache, options);
+            renderer_.render(&repository_, 0, 30, useCache, options);
+            
+            size_t allocations = allocationsDuring([&] {
+                renderer_.render(&repository_, 0, 30, useCache, options);
+            });
+            EXPECT_EQ(allocations, 0u) << mode << (useCache ? " with cache" : "");
+        }
+    }
+}
+
+TEST_F(SvgRendererTest, Render_DropsStateOfRemovedSlides) {
+    SvgOptions options;
+    ASSERT_TRUE(SvgGenerator::parseMode("compact", options));
+    
+    // A long session that keeps replacing the only slide with differently sized shapes
+    int previous = 0;
+    for (int round = 0; round < 1000; ++round) {
+        auto slide = model::SlideFactory::createSlide(0, "T", "C", "default");
+        slide->addShape(model::SlideFactory::createShape("circle", 0.5 + 0.001 * round));
+        int id = repository_.addSlide(std::move(slide));
+        repository_.removeSlide(previous);
+        previous = id;
+        
+        renderer_.render(&repository_, 0, 1, nullptr, options);
+    }
+    
+    EXPECT_LE(renderer_.getInternedCount(), 2u * 4 * 64 + 2);
+    EXPECT_EQ(renderer_.getLayoutEngine().getEntryCount(), 1u);
+    EXPECT_EQ(renderer_.render(&repository_, 0, 1, nullptr, options),
+              SvgGenerator::generateSVG(&repository_, nullptr, options));
+}
+
+TEST_F(SvgRendererTest, Render_ReusesOutputBuffer) {
+    fillRepository(20);
+    
+    const std::string* first = &renderer_.render(&repository_, 0, 20);
+    const char* data = first->data();
+    const std::string* second = &renderer_.render(&repository_, 0, 10);
+    
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(second->data(), data);
+    EXPECT_EQ(renderer_.getDrawCount(), 2u);
+}
+
+TEST_F(SvgRendererTest, HighWaterMarks_TrackLargestDraw) {
+    fillRepository(20);
+    
+    size_t large = renderer_.render(&repository_, 0, 20).size();
+    size_t small = renderer_.render(&repository_, 0, 2).size();
+    
+    EXPECT_LT(small, large);
+    EXPECT_EQ(renderer_.getOutputHighWater(), large);
+    EXPECT_GE(renderer_.getReservedBytes(), large);
+    
+    renderer_.release();
+    EXPECT_LT(renderer_.getReservedBytes(), large);
+    EXPECT_EQ(renderer_.getOutputHighWater(), large);
+}
+
+TEST_F(SvgRendererTest, TakeOutput_LeavesRendererUsable) {
+    fillRepository(3);
+    
+    std::string document = renderer_.takeOutput();
+    EXPECT_TRUE(document.empty());
+    
+    renderer_.render(&repository_, 0, 3);
+    document = renderer_.takeOutput();
+    EXPECT_EQ(document, SvgGenerator::generateSVG(&repository_));
+    EXPECT_EQ(renderer_.render(&repository_, 0, 3), document);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "view/raster/TileRenderer.hpp"
+#include "view/raster/RasterRenderer.hpp"
+#include "model/SlideRepository.hpp"
+#include "model/SlideFactory.hpp"
+#include <fstream>
+#include <iterator>
+
+using namespace slideEditor::view;
+using namespace slideEditor;
+
+class TileRendererTest : public ::testing::Test {
+protected:
+    model::SlideRepository repository_;
+    WorkStealingPool pool_{3};
+    std::string fileA_ = "test_tiles_a.ppm";
+    std::string fileB_ = "test_tiles_b.ppm";
+    
+    void SetUp() override {
+        const char* types[] = {"circle", "rectangle", "triangle", "ellipse"};
+        for (int i = 0; i < 3; ++i) {
+            auto slide = model::SlideFactory::createSlide(0, "T", "C", "default");
+            for (int s = 0; s < 7; ++s) {
+                slide->addShape(model::SlideFactory::createShape(types[s % 4], 0.5 + 0.2 * s,
+                                                                 "blue", "orange"));
+            }
+            repository_.addSlide(std::move(slide));
+        }
+    }
+    
+    void TearDown() override {
+        std::remove(fileA_.c_str());
+        std::remove(fileB_.c_str());
+    }
+    
+    std::vector<char> readFile(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>());
+    }
+};
+
+TEST_F(TileRendererTest, BinShapes_AssignsShapeToOverlappedTilesOnly) {
+    std::vector<RasterShape> scene = {
+        RasterShape{core::ShapeType::CIRCLE, 100, 100, 20, 20, 0, 0, 2.0},   // Tile (1, 1) only
+        RasterShape{core::ShapeType::RECTANGLE, 128, 40, 10, 10, 0, 0, 2.0}  // Straddles columns 1 and 2
+    };
+    
+    TileBins bins = TileRenderer::binShapes(scene, 256, 192, 64);
+    
+    EXPECT_EQ(bins.columns, 4);
+    EXPECT_EQ(bins.rows, 3);
+    EXPECT_EQ(bins.at(1, 1), std::vector<std::uint32_t>{0});
+    EXPECT_TRUE(bins.at(0, 0).empty());
+    EXPECT_EQ(bins.at(1, 0), std::vector<std::uint32_t>{1});
+    EXPECT_EQ(bins.at(2, 0), std::vector<std::uint32_t>{1});
+    EXPECT_TRUE(bins.at(3, 2).empty());
+}
+
+TEST_F(TileRendererTest, Render_MatchesSingleCanvas) {
+    RasterCanvas expected = RasterRenderer::render(&repository_, 0, 3);
+    auto scene = RasterRenderer::buildScene(&repository_, 0, 3);
+    
+    // 100 does not divide 800 x 1950, so edge tiles are partial
+    RasterCanvas tiled = TileRenderer::render(scene, expected.getWidth(), expected.getHeight(),
+                                              RasterRenderer::BACKGROUND, pool_, 100);
+    
+    EXPECT_EQ(tiled.getPixels(), expected.getPixels());
+}
+
+TEST_F(TileRendererTest, RenderToWriter_MatchesSingleCanvasFile) {
+    RasterCanvas expected = RasterRenderer::render(&repository_, 0, 3);
+    ASSERT_TRUE(ImageWriter::save(expected, fileA_, ImageFormat::PPM));
+    
+    auto scene = RasterRenderer::buildScene(&repository_, 0, 3);
+    ImageWriter writer;
+    ASSERT_TRUE(writer.open(fileB_, ImageFormat::PPM, expected.getWidth(), expected.getHeight()));
+    EXPECT_TRUE(TileRenderer::renderToWriter(scene, expected.getWidth(), expected.getHeight(),
+                                             RasterRenderer::BACKGROUND, writer, pool_, 96));
+    EXPECT_TRUE(writer.close());
+    
+    EXPECT_EQ(readFile(fileB_), readFile(fileA_));
+}
+
+TEST_F(TileRendererTest, RenderToFile_UsesTiledPath) {
+    ASSERT_TRUE(RasterRenderer::renderToFile(&repository_, fileA_, ImageFormat::PPM, 1, 3,
+                                             LayoutMode::GRID, &pool_));
+    ASSERT_TRUE(ImageWriter::save(RasterRenderer::render(&repository_, 1, 3), fileB_, ImageFormat::PPM));
+    
+    EXPECT_EQ(readFile(fileA_), readFile(fileB_));
+}
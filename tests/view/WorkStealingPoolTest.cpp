@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "view/WorkStealingPool.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace slideEditor::view;
+
+TEST(WorkStealingPoolTest, Constructor_UsesRequestedThreadCount) {
+    WorkStealingPool pool(3);
+    
+    EXPECT_EQ(pool.getThreadCount(), 3u);
+}
+
+TEST(WorkStealingPoolTest, ParallelFor_RunsEveryIndexOnce) {
+    WorkStealingPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    
+    pool.parallelFor(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+    
+    for (const auto& hit : hits) {
+        EXPECT_EQ(hit.load(), 1);
+    }
+}
+
+TEST(WorkStealingPoolTest, ParallelFor_ZeroCount_ReturnsImmediately) {
+    WorkStealingPool pool(2);
+    bool called = false;
+    
+    pool.parallelFor(0, [&](size_t) { called = true; });
+    
+    EXPECT_FALSE(called);
+}
+
+TEST(WorkStealingPoolTest, ParallelFor_RethrowsTaskException) {
+    WorkStealingPool pool(2);
+    std::atomic<int> completed{0};
+    
+    EXPECT_THROW(pool.parallelFor(50, [&](size_t i) {
+        if (i == 17) {
+            throw std::runtime_error("boom");
+        }
+        completed.fetch_add(1);
+    }), std::runtime_error);
+    
+    EXPECT_EQ(completed.load(), 49);  // The rest of the batch still ran
+}
+
+TEST(WorkStealingPoolTest, ParallelFor_NestedCallsComplete) {
+    WorkStealingPool pool(2);
+    std::atomic<int> total{0};
+    
+    pool.parallelFor(8, [&](size_t) {
+        pool.parallelFor(8, [&](size_t) { total.fetch_add(1); });
+    });
+    
+    EXPECT_EQ(total.load(), 64);
+}
+
+TEST(WorkStealingPoolTest, ParallelFor_ReusableAcrossBatches) {
+    WorkStealingPool pool(3);
+    std::atomic<size_t> sum{0};
+    
+    for (int round = 0; round < 20; ++round) {
+        pool.parallelFor(100, [&](size_t i) { sum.fetch_add(i); });
+    }
+    
+    EXPECT_EQ(sum.load(), 20u * 4950u);
+}